@@ -1,44 +1,36 @@
-QT       += core gui
-QT       += sql
-
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
-
-CONFIG += c++17
-
-# You can make your code fail to compile if it uses deprecated APIs.
-# In order to do so, uncomment the following line.
-#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
-
-INCLUDEPATH += $$PWD/include
-
-SOURCES += \
-    bfs.cpp \
-    dbmanager.cpp \
-    layout.cpp \
-    main.cpp \
-    mainwindow.cpp \
-    mstGraph.cpp \
-    tablemanager.cpp
-
-HEADERS += \
-    bfs.h \
-    bfsNamespace.h \
-    dbmanager.h \
-    layout.h \
-    mainwindow.h \
-    mstGraph.h \
-    tablemanager.h \
-    layout.h \
-    graph.h \
-    graphDFS.h
-
-FORMS += \
-    mainwindow.ui
-
-# Default rules for deployment.
-qnx: target.path = /tmp/$${TARGET}/bin
-else: unix:!android: target.path = /opt/$${TARGET}/bin
-!isEmpty(target.path): INSTALLS += target
-
-RESOURCES += \
-    resource.qrc
+QT       += core gui
+QT       += sql
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++17
+
+# You can make your code fail to compile if it uses deprecated APIs.
+# In order to do so, uncomment the following line.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+include(core.pri)
+
+SOURCES += \
+    dbmanager.cpp \
+    layout.cpp \
+    main.cpp \
+    mainwindow.cpp \
+    tablemanager.cpp
+
+HEADERS += \
+    dbmanager.h \
+    layout.h \
+    mainwindow.h \
+    tablemanager.h
+
+FORMS += \
+    mainwindow.ui
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
+
+RESOURCES += \
+    resource.qrc
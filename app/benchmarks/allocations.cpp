@@ -0,0 +1,172 @@
+#include "allocations.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace {
+	std::atomic<size_t> count{0};
+	std::atomic<size_t> bytes{0};
+	std::atomic<size_t> live{0};	/// bytes currently allocated
+	std::atomic<size_t> peak{0};	/// highest value of live since Reset()
+	std::atomic<size_t> base{0};	/// live at Reset()
+
+	// records an allocation of size bytes requested, taking held bytes
+	void Added(size_t size, size_t held)
+	{
+		count.fetch_add(1, std::memory_order_relaxed);
+		bytes.fetch_add(size, std::memory_order_relaxed);
+		size_t now = live.fetch_add(held, std::memory_order_relaxed) + held;
+		size_t high = peak.load(std::memory_order_relaxed);
+		while (now > high && !peak.compare_exchange_weak(high, now, std::memory_order_relaxed)) {}
+	}
+
+	void Removed(size_t held)
+	{
+		live.fetch_sub(held, std::memory_order_relaxed);
+	}
+}
+
+#ifdef __GLIBC__
+
+// glibc lets the executable replace malloc for every library it loads, so
+// Qt's own QString, QHash and QVector storage is counted too. The blocks
+// come from glibc's allocator, which knows their size when they are freed
+extern "C" {
+	void *__libc_malloc(size_t size);
+	void *__libc_calloc(size_t count, size_t size);
+	void *__libc_realloc(void *pointer, size_t size);
+	void *__libc_memalign(size_t alignment, size_t size);
+	void __libc_free(void *pointer);
+
+	void *malloc(size_t size)
+	{
+		void *block = __libc_malloc(size);
+		if (block)
+			Added(size, malloc_usable_size(block));
+		return block;
+	}
+
+	void *calloc(size_t count, size_t size)
+	{
+		void *block = __libc_calloc(count, size);
+		if (block)
+			Added(count * size, malloc_usable_size(block));
+		return block;
+	}
+
+	void *realloc(void *pointer, size_t size)
+	{
+		size_t held = pointer ? malloc_usable_size(pointer) : 0;
+		void *block = __libc_realloc(pointer, size);
+		if (block || size == 0) {
+			Removed(held);
+			if (block)
+				Added(size, malloc_usable_size(block));
+		}
+		return block;
+	}
+
+	void *memalign(size_t alignment, size_t size)
+	{
+		void *block = __libc_memalign(alignment, size);
+		if (block)
+			Added(size, malloc_usable_size(block));
+		return block;
+	}
+
+	void *aligned_alloc(size_t alignment, size_t size)
+	{
+		return memalign(alignment, size);
+	}
+
+	int posix_memalign(void **pointer, size_t alignment, size_t size)
+	{
+		if (alignment < sizeof(void*) || (alignment & (alignment - 1)))
+			return 22;	// EINVAL
+		*pointer = memalign(alignment, size);
+		return *pointer || !size ? 0 : 12;	// ENOMEM
+	}
+
+	void free(void *pointer)
+	{
+		if (!pointer)
+			return;
+		Removed(malloc_usable_size(pointer));
+		__libc_free(pointer);
+	}
+}
+
+namespace {
+	void *Allocate(size_t size)
+	{
+		void *block = std::malloc(size ? size : 1);
+		if (!block)
+			throw std::bad_alloc();
+		return block;
+	}
+
+	void Release(void *pointer)
+	{
+		std::free(pointer);
+	}
+}
+
+bool Allocations::CountsMalloc() { return true; }
+
+#else
+
+namespace {
+	// every block carries its size in a header so delete can subtract it
+	const size_t HEADER = alignof(std::max_align_t);
+
+	void *Allocate(size_t size)
+	{
+		void *block = std::malloc(size + HEADER);
+		if (!block)
+			throw std::bad_alloc();
+		*static_cast<size_t*>(block) = size;
+		Added(size, size);
+		return static_cast<char*>(block) + HEADER;
+	}
+
+	void Release(void *pointer)
+	{
+		if (!pointer)
+			return;
+		void *block = static_cast<char*>(pointer) - HEADER;
+		Removed(*static_cast<size_t*>(block));
+		std::free(block);
+	}
+}
+
+bool Allocations::CountsMalloc() { return false; }
+
+#endif
+
+void Allocations::Reset()
+{
+	count = 0;
+	bytes = 0;
+	base = live.load();
+	peak = base.load();
+}
+
+Allocations::Stats Allocations::Read()
+{
+	Stats stats;
+	stats.count = count;
+	stats.bytes = bytes;
+	stats.peak = peak > base ? peak - base : 0;
+	stats.live = live > base ? live - base : 0;
+	return stats;
+}
+
+void *operator new(size_t size) { return Allocate(size); }
+void *operator new[](size_t size) { return Allocate(size); }
+void operator delete(void *pointer) noexcept { Release(pointer); }
+void operator delete[](void *pointer) noexcept { Release(pointer); }
+void operator delete(void *pointer, size_t) noexcept { Release(pointer); }
+void operator delete[](void *pointer, size_t) noexcept { Release(pointer); }
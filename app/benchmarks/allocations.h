@@ -0,0 +1,44 @@
+#ifndef ALLOCATIONS_H
+#define ALLOCATIONS_H
+
+#include <cstddef>
+
+/*!
+ * @class Allocations
+ * @brief Counts heap allocations of the benchmark executables. On glibc
+ * allocations.cpp replaces malloc, so Qt's containers and strings are
+ * counted along with operator new; elsewhere it only replaces operator
+ * new and Qt's malloc calls go uncounted. Call Reset() before the
+ * measured code and Read() after it
+ */
+class Allocations {
+public:
+	/*!
+	 * @brief allocations since the last Reset()
+	 */
+	struct Stats {
+		size_t count = 0;	/// allocations, reallocations included
+		size_t bytes = 0;	/// bytes requested
+		size_t peak = 0;	/// highest live heap above the level at Reset()
+		size_t live = 0;	/// live heap above the level at Reset(), at Read()
+	};
+
+	/*!
+	 * @brief starts a new measurement
+	 */
+	static void Reset();
+
+	/*!
+	 * @brief allocations made since Reset()
+	 * @return Stats
+	 */
+	static Stats Read();
+
+	/*!
+	 * @brief whether malloc, and so Qt's own storage, is counted
+	 * @return bool
+	 */
+	static bool CountsMalloc();
+};
+
+#endif // ALLOCATIONS_H
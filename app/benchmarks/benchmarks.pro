@@ -0,0 +1,28 @@
+# Times the graph algorithms on the league's distances and on synthetic
+# geographic graphs; see main.cpp for the options
+
+TEMPLATE = app
+TARGET = benchmarks
+CONFIG += console c++17
+CONFIG -= app_bundle
+QT = core sql
+
+INCLUDEPATH += $$PWD/.. $$PWD/../include
+DEFINES += DATABASE_DIR=\\\"$$PWD/../DataBase\\\"
+
+CORE_DIR = $$OUT_PWD/../core
+win32:CONFIG(release, debug|release): CORE_DIR = $$CORE_DIR/release
+else:win32:CONFIG(debug, debug|release): CORE_DIR = $$CORE_DIR/debug
+
+LIBS += -L$$CORE_DIR -lcore
+win32-g++|!win32: PRE_TARGETDEPS += $$CORE_DIR/libcore.a
+else: PRE_TARGETDEPS += $$CORE_DIR/core.lib
+
+SOURCES += \
+    allocations.cpp \
+    main.cpp \
+    syntheticgraph.cpp
+
+HEADERS += \
+    allocations.h \
+    syntheticgraph.h
@@ -0,0 +1,314 @@
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include <QCoreApplication>
+#include <QFileInfo>
+#include <QHash>
+#include <QTextStream>
+#include <QtSql/QSqlDatabase>
+#include <QtSql/QSqlQuery>
+#include "allocations.h"
+#include "syntheticgraph.h"
+#include "bfs.h"
+#include "csvreader.h"
+#include "distancematrix.h"
+#include "graph.h"
+#include "graphDFS.h"
+#include "mstGraph.h"
+#include "schema.h"
+#include "stadiumgraph.h"
+#include "tripplanner.h"
+
+namespace {
+	/// all-pairs tables need 8 * V^2 bytes; larger graphs skip those rows
+	const int MATRIX_LIMIT = 2000;
+
+	struct Options {
+		QList<int> sizes{32, 1000, 10000, 100000};
+		int degree = 4;
+		unsigned seed = 1;
+		int repeat = 5;
+		QString nflFile = QString(DATABASE_DIR) + "/nfl_distances.csv";
+		bool csv = false;
+	};
+
+	struct Result {
+		QString algorithm;
+		double medianMs = 0;
+		double minMs = 0;
+		Allocations::Stats stats;	/// of the last run
+	};
+
+	QTextStream out(stdout);
+	QTextStream err(stderr);
+
+	/*!
+	 * @brief Times run repeat times. setup runs untimed before every run
+	 */
+	Result Measure(const QString &algorithm, int repeat,
+				   const std::function<void()> &setup, const std::function<void()> &run)
+	{
+		Result result;
+		result.algorithm = algorithm;
+		std::vector<double> times;
+		for (int i = 0; i < repeat; i++) {
+			if (setup)
+				setup();
+			Allocations::Reset();
+			auto start = std::chrono::steady_clock::now();
+			run();
+			auto stop = std::chrono::steady_clock::now();
+			result.stats = Allocations::Read();
+			times.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+		}
+		std::sort(times.begin(), times.end());
+		result.medianMs = times[times.size() / 2];
+		result.minMs = times.front();
+		return result;
+	}
+
+	// fresh in-memory database with the app's schema as the default connection
+	bool ResetDatabase()
+	{
+		QSqlDatabase db = QSqlDatabase::database();
+		db.close();
+		return db.open() && Schema::Migrate(db);
+	}
+
+	bool LoadSynthetic(const SyntheticGraph &graph)
+	{
+		QSqlDatabase db = QSqlDatabase::database();
+		db.transaction();
+		QSqlQuery query(db);
+		bool ok = query.prepare("INSERT INTO teams(id, teamNames) VALUES(?, ?)");
+		for (int i = 0; ok && i < graph.vertices; i++) {
+			query.addBindValue(i + 1);
+			query.addBindValue(QString("Stadium %1").arg(i + 1));
+			ok = query.exec();
+		}
+		ok = ok && query.prepare("INSERT INTO edges(from_team, to_team, distance) VALUES(?, ?, ?)");
+		for (const SyntheticGraph::Road &road : graph.roads) {
+			for (int direction = 0; ok && direction < 2; direction++) {
+				query.addBindValue((direction ? road.v : road.u) + 1);
+				query.addBindValue((direction ? road.u : road.v) + 1);
+				query.addBindValue(road.miles);
+				ok = query.exec();
+			}
+		}
+		return ok && db.commit();
+	}
+
+	// the league's distance file, teams numbered in order of appearance
+	bool LoadDistances(const QString &fileName)
+	{
+		CsvReader csv(fileName);
+		if (!csv.IsOpen())
+			return false;
+
+		QSqlDatabase db = QSqlDatabase::database();
+		db.transaction();
+		QSqlQuery team(db), distance(db);
+		team.prepare("INSERT INTO teams(teamNames) VALUES(?)");
+		distance.prepare("INSERT INTO distance(id, beginStadium, endStadium, distanceTo) "
+						 "VALUES(?, ?, ?, ?)");
+		QHash<QString, int> ids;
+		bool ok = true;
+		while (ok && csv.Next()) {
+			if (csv.Size() < 4)
+				continue;
+			QString name = csv.Text(0);
+			if (!ids.contains(name)) {
+				team.addBindValue(name);
+				ok = team.exec();
+				ids.insert(name, team.lastInsertId().toInt());
+			}
+			distance.addBindValue(ids.value(name));
+			distance.addBindValue(csv.Text(1));
+			distance.addBindValue(csv.Text(2));
+			distance.addBindValue(csv.Text(3).toInt());
+			ok = ok && distance.exec();
+		}
+		return ok && !csv.Failed() && Schema::RefreshEdges(db) && db.commit();
+	}
+
+	QList<Result> RunAll(const Options &options)
+	{
+		QList<Result> results;
+		results.append(Measure("StadiumGraph::Rebuild", options.repeat, {}, [] {
+			StadiumGraph::Rebuild();
+		}));
+		std::shared_ptr<const StadiumGraph> stadiums = StadiumGraph::instance();
+		int start = stadiums->TeamID(0);
+
+		Graph<int> graph;
+		graph.GenerateGraph();
+		std::vector<int> order, costs(graph.Size()), parents(graph.Size());
+		results.append(Measure("Graph::DijkstraPathFinder", options.repeat,
+							   [&] { order.clear(); },
+							   [&] { graph.DijkstraPathFinder(start, order, costs.data(), parents.data()); }));
+
+		for (MstAlgorithm algorithm : {MstAlgorithm::Prim, MstAlgorithm::Kruskal}) {
+			results.append(Measure(algorithm == MstAlgorithm::Prim ? "mstGraph::PrimMST"
+																   : "mstGraph::KruskalMST",
+								   options.repeat, {}, [algorithm] {
+				mstGraph tree(algorithm);
+				std::vector<mstEdge> edges;
+				tree.GetMST(edges);
+			}));
+		}
+
+		bfs bfsEngine;
+		bfsEngine.AddEdges();
+		results.append(Measure("bfs::bfsAlgo", options.repeat, {}, [&] {
+			bfsEngine.bfsAlgo(start);
+		}));
+
+		dfs::GraphDFS<int> graphDFS;
+		graphDFS.GenerateGraph();
+		results.append(Measure("GraphDFS::dfs", options.repeat,
+							   [&] { order.clear(); },
+							   [&] { graphDFS.dfs(start, order); }));
+
+		if (stadiums->Size() > MATRIX_LIMIT)
+			return results;
+
+		std::shared_ptr<const DistanceMatrix> matrix;
+		results.append(Measure("DistanceMatrix", options.repeat, {}, [&] {
+			matrix = std::make_shared<const DistanceMatrix>(stadiums);
+		}));
+
+		// TripPlanner::Greedy is RecursiveAlgo's nearest neighbour rule
+		// without the widgets, visiting every other stadium
+		TripPlanner planner(matrix);
+		std::vector<int> stops(stadiums->Size() - 1);
+		std::iota(stops.begin(), stops.end(), 1);
+		results.append(Measure("TripPlanner::Greedy", options.repeat, {}, [&] {
+			planner.Greedy(0, stops);
+		}));
+		return results;
+	}
+
+	// one line of the text table: two left aligned columns, the rest right aligned
+	QString Row(const QStringList &columns)
+	{
+		const int widths[] = {16, 28, 9, 10, 12, 12, 11, 12, 11};
+		QString line;
+		for (int i = 0; i < columns.size(); i++)
+			line += i < 2 ? columns[i].leftJustified(widths[i])
+						  : columns[i].rightJustified(widths[i]);
+		return line + "\n";
+	}
+
+	void Print(const Options &options, const QString &graph, int vertices, int edges,
+			   const QList<Result> &results)
+	{
+		for (const Result &result : results) {
+			if (options.csv) {
+				out << graph << ',' << result.algorithm << ',' << vertices << ',' << edges << ','
+					<< result.medianMs << ',' << result.minMs << ',' << result.stats.count << ','
+					<< result.stats.bytes << ',' << result.stats.peak << '\n';
+			} else {
+				out << Row({graph, result.algorithm, QString::number(vertices), QString::number(edges),
+							QString::number(result.medianMs, 'f', 3),
+							QString::number(result.minMs, 'f', 3),
+							QString::number(result.stats.count),
+							QString::number(result.stats.bytes / 1024),
+							QString::number(result.stats.peak / 1024)});
+			}
+		}
+		out.flush();
+	}
+
+	bool ParseOptions(QStringList args, Options &options)
+	{
+		while (!args.isEmpty()) {
+			QString option = args.takeFirst();
+			if (option == "--csv") {
+				options.csv = true;
+				continue;
+			}
+			if (args.isEmpty())
+				return false;
+
+			QString value = args.takeFirst();
+			bool ok = true;
+			if (option == "--sizes") {
+				options.sizes.clear();
+				for (const QString &size : value.split(',', QString::SkipEmptyParts)) {
+					options.sizes.append(size.toInt(&ok));
+					if (!ok || options.sizes.back() < 2)
+						return false;
+				}
+			} else if (option == "--degree") {
+				options.degree = value.toInt(&ok);
+			ok = ok && options.degree > 0;
+			} else if (option == "--seed") {
+				options.seed = value.toUInt(&ok);
+			} else if (option == "--repeat") {
+				options.repeat = value.toInt(&ok);
+				ok = ok && options.repeat > 0;
+			} else if (option == "--nfl") {
+				options.nflFile = value;
+			} else {
+				return false;
+			}
+			if (!ok)
+				return false;
+		}
+		return true;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	QCoreApplication app(argc, argv);
+	QStringList args = app.arguments();
+	args.removeFirst();
+
+	Options options;
+	if (!ParseOptions(args, options)) {
+		err << "usage: benchmarks [--sizes 32,1000,10000,100000] [--degree 4] [--seed 1]\n"
+			   "                  [--repeat 5] [--nfl nfl_distances.csv] [--csv]\n"
+			   "Times every graph algorithm on the league's distance file and on\n"
+			   "random geographic graphs. Times are milliseconds (median and best of\n"
+			   "--repeat runs); allocations, allocated KB and peak heap KB are from\n"
+			   "the last run. "
+			<< (Allocations::CountsMalloc()
+				? "They count every malloc, Qt's strings and containers included.\n"
+				: "They count operator new only; Qt's strings and containers\n"
+				  "allocate with malloc and are not counted.\n");
+		return 2;
+	}
+
+	QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE");
+	db.setDatabaseName(":memory:");
+
+	if (options.csv)
+		out << "graph,algorithm,vertices,edges,median_ms,min_ms,allocations,bytes,peak_bytes\n";
+	else
+		out << Row({"graph", "algorithm", "vertices", "edges", "median ms", "min ms",
+					"allocs", "alloc KB", "peak KB"});
+
+	if (!QFileInfo::exists(options.nflFile)) {
+		err << "benchmarks: " << options.nflFile << " not found, skipping the league graph\n";
+	} else if (!ResetDatabase() || !LoadDistances(options.nflFile)) {
+		err << "benchmarks: could not load " << options.nflFile << "\n";
+		return 1;
+	} else {
+		QList<Result> results = RunAll(options);
+		std::shared_ptr<const StadiumGraph> graph = StadiumGraph::instance();
+		Print(options, "nfl", graph->Size(), graph->Csr().edges.size(), results);
+	}
+
+	for (int size : options.sizes) {
+		SyntheticGraph graph = SyntheticGraph::Geographic(size, options.degree, options.seed);
+		if (!ResetDatabase() || !LoadSynthetic(graph)) {
+			err << "benchmarks: could not load the synthetic graph of " << size << " vertices\n";
+			return 1;
+		}
+		QList<Result> results = RunAll(options);
+		Print(options, QString("synthetic-%1").arg(size), size, 2 * graph.roads.size(), results);
+	}
+	return 0;
+}
@@ -0,0 +1,126 @@
+#include "syntheticgraph.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <utility>
+
+namespace {
+	const double WIDTH = 2700;	/// miles east to west
+	const double HEIGHT = 1600;	/// miles north to south
+
+	struct Point {
+		double x;
+		double y;
+	};
+
+	int Miles(const Point &a, const Point &b)
+	{
+		return std::max(1, (int) std::lround(std::hypot(a.x - b.x, a.y - b.y)));
+	}
+
+	int Find(std::vector<int> &parent, int vertex)
+	{
+		while (parent[vertex] != vertex)
+			vertex = parent[vertex] = parent[parent[vertex]];
+		return vertex;
+	}
+}
+
+SyntheticGraph SyntheticGraph::Geographic(int vertices, int degree, unsigned seed)
+{
+	SyntheticGraph graph;
+	graph.vertices = vertices;
+	if (vertices < 2 || degree < 1)
+		return graph;
+	degree = std::min(degree, vertices - 1);
+
+	std::mt19937 random(seed);
+	std::uniform_real_distribution<double> x(0, WIDTH), y(0, HEIGHT);
+	std::vector<Point> points(vertices);
+	for (Point &point : points)
+		point = Point{x(random), y(random)};
+
+	// bucket the points in a grid of about two points per cell, then search
+	// rings of cells around each point until degree neighbours are certain
+	int columns = std::max(1, (int) std::sqrt(vertices / 2.0 * WIDTH / HEIGHT));
+	int rows = std::max(1, (int) std::sqrt(vertices / 2.0 * HEIGHT / WIDTH));
+	double cellWidth = WIDTH / columns, cellHeight = HEIGHT / rows;
+	auto column = [&](const Point &p) { return std::min(columns - 1, (int) (p.x / cellWidth)); };
+	auto row = [&](const Point &p) { return std::min(rows - 1, (int) (p.y / cellHeight)); };
+
+	std::vector<int> cellStart(columns * rows + 1, 0), cellPoints(vertices);
+	for (const Point &point : points)
+		cellStart[row(point) * columns + column(point) + 1]++;
+	std::partial_sum(cellStart.begin(), cellStart.end(), cellStart.begin());
+	std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+	for (int i = 0; i < vertices; i++)
+		cellPoints[fill[row(points[i]) * columns + column(points[i])]++] = i;
+
+	std::vector<std::pair<int, int>> pairs;
+	std::vector<std::pair<double, int>> nearest;
+	for (int i = 0; i < vertices; i++) {
+		int c = column(points[i]), r = row(points[i]);
+		nearest.clear();
+		for (int ring = 0; ; ring++) {
+			for (int dr = -ring; dr <= ring; dr++) {
+				for (int dc = -ring; dc <= ring; dc++) {
+					if (std::max(std::abs(dr), std::abs(dc)) != ring)
+						continue;	// inner rings are done
+					int nr = r + dr, nc = c + dc;
+					if (nr < 0 || nr >= rows || nc < 0 || nc >= columns)
+						continue;
+					int cell = nr * columns + nc;
+					for (int k = cellStart[cell]; k < cellStart[cell + 1]; k++) {
+						int j = cellPoints[k];
+						if (j != i)
+							nearest.emplace_back(std::hypot(points[i].x - points[j].x,
+															points[i].y - points[j].y), j);
+					}
+				}
+			}
+			// every point outside the searched rings is at least this far
+			double reach = ring * std::min(cellWidth, cellHeight);
+			if ((int) nearest.size() >= degree) {
+				std::nth_element(nearest.begin(), nearest.begin() + degree - 1, nearest.end());
+				if (nearest[degree - 1].first <= reach)
+					break;
+			}
+			if (ring > columns + rows)
+				break;
+		}
+		int found = std::min(degree, (int) nearest.size());
+		std::partial_sort(nearest.begin(), nearest.begin() + found, nearest.end());
+		for (int k = 0; k < found; k++)
+			pairs.emplace_back(std::min(i, nearest[k].second), std::max(i, nearest[k].second));
+	}
+	std::sort(pairs.begin(), pairs.end());
+	pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+	std::vector<int> parent(vertices);
+	std::iota(parent.begin(), parent.end(), 0);
+	for (const auto &pair : pairs) {
+		graph.roads.push_back(Road{pair.first, pair.second, Miles(points[pair.first], points[pair.second])});
+		parent[Find(parent, pair.first)] = Find(parent, pair.second);
+	}
+
+	// chain the components west to east through their westernmost points
+	std::vector<int> roots;
+	for (int i = 0; i < vertices; i++)
+		if (Find(parent, i) == i)
+			roots.push_back(i);
+	std::vector<int> west(vertices, -1);
+	for (int i = 0; i < vertices; i++) {
+		int &best = west[Find(parent, i)];
+		if (best == -1 || points[i].x < points[best].x)
+			best = i;
+	}
+	std::sort(roots.begin(), roots.end(), [&](int a, int b) {
+		return points[west[a]].x < points[west[b]].x;
+	});
+	for (size_t k = 1; k < roots.size(); k++) {
+		int a = west[roots[k - 1]], b = west[roots[k]];
+		graph.roads.push_back(Road{a, b, Miles(points[a], points[b])});
+	}
+	return graph;
+}
@@ -0,0 +1,37 @@
+#ifndef SYNTHETICGRAPH_H
+#define SYNTHETICGRAPH_H
+
+#include <vector>
+
+/*!
+ * @struct SyntheticGraph
+ * @brief Random stadium map for the benchmarks. Stadiums are points spread
+ * uniformly over a 2700 x 1600 mile box (about the contiguous US), each
+ * joined to its nearest neighbours with the rounded straight-line mileage.
+ * Components left apart are chained together, so the graph is connected.
+ * The same size, degree and seed always give the same graph
+ */
+struct SyntheticGraph {
+	/*!
+	 * @brief undirected road between two stadiums
+	 */
+	struct Road {
+		int u;
+		int v;
+		int miles;
+	};
+
+	int vertices = 0;
+	std::vector<Road> roads;	/// one entry per connected pair
+
+	/*!
+	 * @brief Generates a graph
+	 * @param vertices; number of stadiums
+	 * @param degree; nearest neighbours joined to every stadium
+	 * @param seed; random seed
+	 * @return graph, without roads if degree < 1
+	 */
+	static SyntheticGraph Geographic(int vertices, int degree, unsigned seed);
+};
+
+#endif // SYNTHETICGRAPH_H
@@ -1,82 +1,101 @@
-#include "bfs.h"
-
-bfs::bfs()
-{
-    bfsList.clear();                                              //always clears the list
-	totalDist = 0;                                                //sets the total distance to 0
-    cities = DBManager::instance()->GetNumTeams();                //gets the total number of teams from data table
-    adjList = new std::vector<generalContainer::node>[cities + 1];//Creates adj list based on the number of teams + 1 so each index correlates to
-                                                                  //    its respective id in the datatable
-    visited = new bool [cities+1];                                //Parallel array that marks if an index has been visited
-}
-void bfs::AddEdges()
-{
-    //used to initialize the adj list
-    //  each index is teams id and the element is a vector which contains
-    //  the ending team and weight
-    for(int index=1; index< cities+1 ; index++)
-    {
-        adjList[index] = DBManager::instance()->getAdjList(index);
-    }
-}
-
-void bfs::bfsAlgo(int start)
-{
-    std::queue<int> tempQ;
-    int vertex = 0;
-    QString teamName; // used to hold the teamName
-
-    //Initialize the visited array to false(all team unexplored)
-    for(int index = 0; index < cities+1; index++)
-    {
-        visited[index] = false;
-    }
-
-    // UNCOMMENT LINES 36 TO DEBUG BFS INCASE TOTAL DISTANCE IS INCORRECT
-    //qDebug() << "\n\n BFS TRIPS AND THEIR RESPECTIVE DISTANCES\n-------------------\n";
-    vertex = start;
-    tempQ.push(vertex);
-    visited[vertex] = true;
-
-    while(!tempQ.empty())
-    {
-        vertex = tempQ.front();
-        tempQ.pop();
-
-        //grabs the team name based on its id and pushes it to the QStringList
-		teamName = DBManager::instance()->GetTeamName(vertex);
-        bfsList << teamName;
-
-        for(auto i: adjList[vertex])
-        {
-            if(visited[i.end] ==false)
-            {
-                tempQ.push(i.end);
-				totalDist+=i.weight;
-
-                //UNCOMMENT LINE 58 TO DEBUG IN CASE NUMBER IS WRONG
-                //qDebug() << DBManager::instance()->getTeamName(vertex)<< " " << DBManager::instance()->getTeamName(i.end) << " " << i.weight;
-
-                visited[i.end] = true;
-            }
-        }
-    }
-
-    //UNCOMMENT LINES 67 - 72 TO DEBUG INCASE BFS TRIP IS WRONG
-
-    /*
-    qDebug() << "\n\n THIS IS THE ORDER OF TEAMS IN THE BFS TRAVERSAL \n-----------------------\n";
-    for(auto i: bfsList)
-    {
-        qDebug() << i;
-    }
-    */
-}
-QStringList bfs::GetBfsList()
-{
-    return bfsList;
-}
-int bfs::GetTotalDistance()
-{
-	return totalDist;
-}
+#include "bfs.h"
+
+bfs::bfs()
+    : totalDist(0), frontierHead(0), frontierCount(0)
+{
+}
+
+void bfs::AddEdges()
+{
+    //used to initialize the adj list from the shared stadium graph
+    //  each index is a vertex and the element is the list of edges
+    //  to the ending vertices, sorted by weight
+    std::shared_ptr<const StadiumGraph> stadiums = StadiumGraph::instance();
+    if(graph && graph->Version() == stadiums->Version())
+        return;                                                   //already loaded
+
+    graph = stadiums;
+    int cities = graph->Size();
+    std::vector<std::vector<generalContainer::node>> adjList(cities);
+    for(int vertex = 0; vertex < cities; vertex++)
+    {
+        for(const auto &edge: graph->Adjacent(vertex))
+            adjList[vertex].push_back(edge);
+        std::stable_sort(adjList[vertex].begin(), adjList[vertex].end(), generalContainer::lighter);
+    }
+    adjacency.build(adjList);
+
+    //every vertex is queued at most once, so the buffers never grow
+    bfsOrder.reserve(cities);
+    frontier.assign(cities, 0);
+    visited.assign(cities, false);
+}
+
+void bfs::Push(int vertex)
+{
+    frontier[(frontierHead + frontierCount) % frontier.size()] = vertex;
+    frontierCount++;
+}
+
+int bfs::Pop()
+{
+    int vertex = frontier[frontierHead];
+    frontierHead = (frontierHead + 1) % frontier.size();
+    frontierCount--;
+    return vertex;
+}
+
+void bfs::bfsAlgo(int start)
+{
+    AddEdges();
+
+    totalDist = 0;
+    bfsOrder.clear();
+    frontierHead = 0;
+    frontierCount = 0;
+    std::fill(visited.begin(), visited.end(), false);             //all team unexplored
+
+    int vertex = graph->FindVertexByID(start);
+    if(vertex == -1)
+        return;
+
+    Push(vertex);
+    visited[vertex] = true;
+
+    while(frontierCount > 0)
+    {
+        vertex = Pop();
+        bfsOrder.push_back(vertex);
+
+        for(const auto &i: adjacency.adjacent(vertex))
+        {
+            if(!visited[i.end])
+            {
+                Push(i.end);
+				totalDist+=i.weight;
+                visited[i.end] = true;
+            }
+        }
+    }
+}
+
+std::vector<int> bfs::GetBfsOrder() const
+{
+    std::vector<int> ids;
+    for(int vertex: bfsOrder)
+        ids.push_back(graph->TeamID(vertex));
+    return ids;
+}
+
+QStringList bfs::GetBfsList()
+{
+    QStringList bfsList;
+    for(int vertex: bfsOrder)
+        bfsList << graph->TeamName(vertex);
+    return bfsList;
+}
+
+int bfs::GetTotalDistance()
+{
+	return totalDist;
+}
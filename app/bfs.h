@@ -1,69 +1,95 @@
-#ifndef BFS_H
-#define BFS_H
-
-#include <vector>
-#include <QStringList>
-#include <dbmanager.h>
-#include <queue>
-#include <bfsNamespace.h>
-
-class bfs
-{
-private:
-    /*!
-     * @brief ADJ LIST with the index of the array representing the teams id
-     *          the element of the array is a vector the list of adj teams and their weights
-     */
-    std::vector<generalContainer::node>* adjList;
-
-    /*!
-     * @brief holds the total distance travelled as a int
-     */
-	int totalDist;
-
-    /*!
-     * @brief contains the names of the team to visit in bfs order
-     */
-    QStringList bfsList;
-
-    /*!
-     * @brief number of cities to visit
-     */
-    int cities;
-
-    /*!
-     * @brief bool array to check if the city has been visited
-     */
-    bool *visited;
-public:
-    /*!
-     * @brief default Constructor
-     */
-    bfs();
-
-    /*!
-     * @brief initializes the ADJ list from the values in the data table
-     */
-	void AddEdges(); // initializes the adj list
-
-    /*!
-     * @brief preforms a bfs traversal through the team
-     *
-     * @param start; The team you want to start at
-     */
-    void bfsAlgo(int start);// actual bfs Algo
-
-    /*!
-     * @brief returns the total distance traveled
-     * @return  int
-     */
-	int GetTotalDistance(); // returns the total distance
-
-    /*!
-     * @brief returns a QStringList of all the teams in their bfs order
-     * @return QStringList
-     */
-	QStringList GetBfsList();
-};
-
-#endif // BFS_H
+#ifndef BFS_H
+#define BFS_H
+
+#include <memory>
+#include <vector>
+#include <QStringList>
+#include <bfsNamespace.h>
+#include "stadiumgraph.h"
+
+/*!
+ * @brief breadth first search over the shared stadium graph. Buffers are
+ * sized when the graph is loaded and reused by every search, so repeated
+ * searches on the same graph neither query the database nor allocate;
+ * team names are only looked up when GetBfsList is called
+ */
+class bfs
+{
+private:
+    /*!
+     * @brief snapshot the adjacency was built from, null until AddEdges
+     */
+    std::shared_ptr<const StadiumGraph> graph;
+
+    /*!
+     * @brief adjacency indexed by vertex, each vertex's edges sorted by weight
+     */
+    generalContainer::csrGraph adjacency;
+
+    /*!
+     * @brief holds the total distance travelled as a int
+     */
+	int totalDist;
+
+    /*!
+     * @brief vertices in bfs order
+     */
+    std::vector<int> bfsOrder;
+
+    /*!
+     * @brief ring buffer of vertices waiting to be visited
+     */
+    std::vector<int> frontier;
+    int frontierHead;  // index of the next vertex to visit
+    int frontierCount; // vertices waiting
+
+    /*!
+     * @brief marks the vertices that have been queued
+     */
+    std::vector<bool> visited;
+
+    // adds a vertex to the back of the ring buffer
+    void Push(int vertex);
+
+    // removes the vertex at the front of the ring buffer
+    int Pop();
+
+public:
+    /*!
+     * @brief default Constructor; nothing is loaded until the first search
+     */
+    bfs();
+
+    /*!
+     * @brief loads the adjacency from the shared graph if it changed since
+     * the last call
+     */
+	void AddEdges(); // initializes the adj list
+
+    /*!
+     * @brief preforms a bfs traversal through the team
+     *
+     * @param start; id of the team you want to start at
+     */
+    void bfsAlgo(int start);// actual bfs Algo
+
+    /*!
+     * @brief returns the total distance traveled
+     * @return  int
+     */
+	int GetTotalDistance(); // returns the total distance
+
+    /*!
+     * @brief returns the ids of the teams in their bfs order
+     * @return vector of team ids
+     */
+	std::vector<int> GetBfsOrder() const;
+
+    /*!
+     * @brief returns a QStringList of all the teams in their bfs order
+     * @return QStringList
+     */
+	QStringList GetBfsList();
+};
+
+#endif // BFS_H
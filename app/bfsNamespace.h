@@ -1,21 +1,77 @@
-#ifndef BFSNAMESPACE_H
-#define BFSNAMESPACE_H
-
-#include <algorithm>
-
-namespace generalContainer
-{
-    /*!
-     * @brief node is a container for each element in the adj list
-     * @param end; id of the ending team based on index in adj list
-     * @param weight; weight between index in the adj list and the end variable
-     */
-    struct node
-    {
-        int end; // id of ending team
-        int weight; //weight from vertex to ending team
-        node():end(0),weight(0){};
-    };
-}
-
-#endif // BFSNAMESPACE_H
+#ifndef BFSNAMESPACE_H
+#define BFSNAMESPACE_H
+
+#include <algorithm>
+#include <vector>
+
+namespace generalContainer
+{
+    /*!
+     * @brief node is a container for each element in the adj list
+     * @param end; id of the ending team based on index in adj list
+     * @param weight; weight between index in the adj list and the end variable
+     */
+    struct node
+    {
+        int end; // id of ending team
+        int weight; //weight from vertex to ending team
+        node():end(0),weight(0){};
+        node(int end, int weight):end(end),weight(weight){};
+    };
+
+    /*!
+     * @brief orders nodes by weight, for sorting adjacency lists shortest first
+     */
+    inline bool lighter(const node& n1, const node& n2)
+    {
+        return n1.weight < n2.weight;
+    }
+
+    /*!
+     * @brief nodeRange is a read-only view over the edges of one vertex
+     */
+    struct nodeRange
+    {
+        const node* first;
+        const node* last;
+        const node* begin() const { return first; }
+        const node* end() const { return last; }
+        int size() const { return last - first; }
+        bool empty() const { return first == last; }
+    };
+
+    /*!
+     * @brief csrGraph is a compressed sparse row adjacency list. The edges of
+     * vertex v are edges[offsets[v]] up to (not including) edges[offsets[v + 1]]
+     */
+    struct csrGraph
+    {
+        std::vector<int> offsets; // size is number of vertices + 1
+        std::vector<node> edges;  // node.end is a vertex index
+
+        /*!
+         * @brief packs a vector-of-vectors adjacency list into csr form
+         * @param adjList; adjList[v] holds the edges leaving v
+         */
+        void build(const std::vector<std::vector<node>>& adjList)
+        {
+            offsets.assign(1, 0);
+            edges.clear();
+            for (const auto& list : adjList)
+            {
+                edges.insert(edges.end(), list.begin(), list.end());
+                offsets.push_back(edges.size());
+            }
+        }
+
+        int numVertices() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+        nodeRange adjacent(int vertex) const
+        {
+            return nodeRange{edges.data() + offsets[vertex],
+                             edges.data() + offsets[vertex + 1]};
+        }
+    };
+}
+
+#endif // BFSNAMESPACE_H
@@ -0,0 +1,158 @@
+#include "catalog.h"
+#include <QtSql/QSqlQuery>
+#include <QDebug>
+
+Catalog* Catalog::instance()
+{
+	static Catalog instance;
+	return &instance;
+}
+
+Catalog::Catalog()
+{
+	nameToID.max_load_factor(LOAD_FACTOR);
+	teams.max_load_factor(LOAD_FACTOR);
+	souvenirs.max_load_factor(LOAD_FACTOR);
+	prices.max_load_factor(LOAD_FACTOR);
+	Reload();
+}
+
+void Catalog::Reload()
+{
+	teamNames.clear();
+	nameToID.clear();
+	teams.clear();
+	souvenirs.clear();
+	prices.clear();
+	for (Listing &listing : listings)
+		listing.clear();
+
+	QSqlQuery query;
+	query.setForwardOnly(true);
+
+	if (!query.exec("SELECT id, teamNames FROM teams ORDER BY id"))
+		qDebug() << "Catalog::Reload() : teams query failed";
+	while (query.next())
+		AddTeam(query.value(0).toInt(), query.value(1).toString());
+
+	if (!query.exec("SELECT id, stadiumName, seatCap, location, conference, "
+					"division, surfaceType, roofType, dateOpen FROM information"))
+		qDebug() << "Catalog::Reload() : information query failed";
+	while (query.next()) {
+		Team team;
+		team.id = query.value(0).toInt();
+		team.stadiumName = query.value(1).toString();
+		team.seatCap = query.value(2).toInt();
+		team.location = query.value(3).toString();
+		team.conference = query.value(4).toString();
+		team.division = query.value(5).toString();
+		team.surfaceType = query.value(6).toString();
+		team.roofType = query.value(7).toString();
+		team.dateOpen = query.value(8).toInt();
+		SetInformation(team);
+	}
+
+	if (!query.exec("SELECT id, items, price FROM souvenir"))
+		qDebug() << "Catalog::Reload() : souvenir query failed";
+	while (query.next())
+		SetSouvenir(query.value(0).toInt(), query.value(1).toString(),
+					query.value(2).toInt());
+	query.finish();
+
+	// clear() keeps the buckets, so a smaller import would leave them sparse
+	nameToID.shrink_to_fit();
+	teams.shrink_to_fit();
+	souvenirs.shrink_to_fit();
+	prices.shrink_to_fit();
+}
+
+int Catalog::TeamID(QStringView teamName) const
+{
+	auto found = nameToID.find(teamName);
+	return found == nameToID.end() ? -1 : found->second;
+}
+
+const Catalog::Team *Catalog::FindTeam(int id) const
+{
+	auto found = teams.find(id);
+	return found == teams.end() ? nullptr : &found->second;
+}
+
+const QStringList &Catalog::Souvenirs(int teamID) const
+{
+	static const QStringList none;
+	auto found = souvenirs.find(teamID);
+	return found == souvenirs.end() ? none : found->second;
+}
+
+int Catalog::SouvenirPrice(int teamID, QStringView item) const
+{
+	auto found = prices.find(SouvenirView(teamID, item));
+	return found == prices.end() ? -1 : found->second;
+}
+
+void Catalog::AddTeam(int id, const QString &teamName)
+{
+	if (teams.find(id) != teams.end())
+		return;
+
+	Team team;
+	team.id = id;
+	team.name = teamName;
+	teams[id] = team;
+	nameToID[teamName] = id;
+
+	// ids only grow, so appending keeps the list ordered by id
+	teamNames.push_back(teamName);
+}
+
+void Catalog::SetInformation(const Team &team)
+{
+	auto found = teams.find(team.id);
+	if (found == teams.end()) {
+		qDebug() << "Catalog::SetInformation(Team) : unknown team" << team.id;
+		return;
+	}
+
+	// the old keys find the team's place in each listing
+	for (int order = 0; found->second.listed && order < int(ListOrder::Count); order++)
+		listings[order].erase(Key(found->second, ListOrder(order)));
+
+	QString name = found->second.name;
+	found->second = team;
+	found->second.name = name;
+	found->second.listed = true;
+
+	for (int order = 0; order < int(ListOrder::Count); order++)
+		listings[order].insert({Key(found->second, ListOrder(order)), team.id});
+}
+
+Catalog::ListKey Catalog::Key(const Team &team, ListOrder order)
+{
+	switch (order) {
+	case ListOrder::TeamName:		return ListKey{0, team.name, team.id};
+	case ListOrder::Conference:		return ListKey{0, team.conference, team.id};
+	case ListOrder::StadiumName:	return ListKey{0, team.stadiumName, team.id};
+	case ListOrder::DateOpened:		return ListKey{team.dateOpen, QString(), team.id};
+	case ListOrder::Capacity:		return ListKey{team.seatCap, QString(), team.id};
+	default:						return ListKey{team.id, QString(), team.id};
+	}
+}
+
+void Catalog::SetSouvenir(int teamID, const QString &item, int price)
+{
+	auto found = prices.find(SouvenirView(teamID, item));
+	if (found == prices.end()) {
+		prices[SouvenirKey{teamID, item}] = price;
+		souvenirs[teamID].push_back(item);
+	} else {
+		found->second = price;
+	}
+}
+
+void Catalog::RemoveSouvenir(int teamID, const QString &item)
+{
+	if (prices.erase(SouvenirView(teamID, item)) == 0)
+		return;
+	souvenirs[teamID].removeOne(item);
+}
@@ -0,0 +1,221 @@
+#ifndef CATALOG_H
+#define CATALOG_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+#include <tuple>
+#include <vector>
+#include "flat_map.h"
+#include "unordered_map.h"
+
+/*!
+ * @class Catalog
+ * @brief In-memory copy of the teams, information and souvenir tables. It
+ * is loaded once and kept in step by DBManager's write methods, so lookups
+ * never touch SQLite; the database only provides durability
+ */
+class Catalog {
+public:
+	/*!
+	 * @brief team row joined with its information row
+	 */
+	struct Team {
+		int id = -1;
+		QString name;
+		QString stadiumName;
+		int seatCap = 0;
+		QString location;
+		QString conference;
+		QString division;
+		QString surfaceType;
+		QString roofType;
+		int dateOpen = 0;
+		bool listed = false;	/// has an information row
+	};
+
+	/*!
+	 * @brief orders of the stadium listing, in the list page's combo box order
+	 */
+	enum class ListOrder {
+		None,		/// by team id, the order information rows are added in
+		TeamName,
+		Conference,
+		StadiumName,
+		DateOpened,
+		Capacity,
+		Count
+	};
+
+	/*!
+	 * @brief sort position of a team in one listing; the id breaks ties
+	 */
+	struct ListKey {
+		int number;		/// seat capacity, opening year or id; 0 for text orders
+		QString text;	/// team, conference or stadium name; empty for numeric orders
+		int id;
+		bool operator<(const ListKey &rhs) const
+		{ return std::tie(number, text, id) < std::tie(rhs.number, rhs.text, rhs.id); }
+	};
+
+	typedef nonstd::flat_map<ListKey, int> Listing;	/// sort position -> team id
+
+	/*!
+	 * @brief Catalog loaded from the database on first use
+	 * @return Pointer to the catalog
+	 */
+	static Catalog* instance();
+
+	/*!
+	 * @brief Deleted copy constructor
+	 */
+	Catalog(const Catalog&) = delete;
+
+	/*!
+	 * @brief Deleted copy assignment
+	 */
+	Catalog& operator=(const Catalog&) = delete;
+
+	/*!
+	 * @brief Reloads every table, e.g. after a bulk import
+	 */
+	void Reload();
+
+	/*!
+	 * @brief number of teams
+	 * @return int
+	 */
+	int TeamCount() const { return teamNames.size(); }
+
+	/*!
+	 * @brief team names ordered by id
+	 * @return QStringList
+	 */
+	const QStringList &TeamNames() const { return teamNames; }
+
+	/*!
+	 * @brief id of a team; takes a view so names cut out of larger strings
+	 * are looked up without a copy
+	 * @param teamName
+	 * @return id, -1 if there is no such team
+	 */
+	int TeamID(QStringView teamName) const;
+
+	/*!
+	 * @brief team by id
+	 * @param id
+	 * @return team, nullptr if there is no such team
+	 */
+	const Team *FindTeam(int id) const;
+
+	/*!
+	 * @brief teams with an information row in one order. Every order is
+	 * kept up to date as information rows change, so switching between
+	 * them is free
+	 * @param order
+	 * @return Listing; iterate its team ids in order
+	 */
+	const Listing &Listed(ListOrder order) const { return listings[int(order)]; }
+
+	/*!
+	 * @brief souvenir names of a team in table order
+	 * @param teamID
+	 * @return QStringList, empty for unknown teams
+	 */
+	const QStringList &Souvenirs(int teamID) const;
+
+	/*!
+	 * @brief price of a souvenir
+	 * @param teamID
+	 * @param item
+	 * @return price in cents, -1 if the team has no such souvenir
+	 */
+	int SouvenirPrice(int teamID, QStringView item) const;
+
+	/*!
+	 * @brief records a team inserted into the teams table
+	 * @param id
+	 * @param teamName
+	 */
+	void AddTeam(int id, const QString &teamName);
+
+	/*!
+	 * @brief records an inserted or updated information row
+	 * @param team; id selects the team, name is ignored
+	 */
+	void SetInformation(const Team &team);
+
+	/*!
+	 * @brief records an inserted souvenir or a new price
+	 * @param teamID
+	 * @param item
+	 * @param price; in cents
+	 */
+	void SetSouvenir(int teamID, const QString &item, int price);
+
+	/*!
+	 * @brief records a deleted souvenir
+	 * @param teamID
+	 * @param item
+	 */
+	void RemoveSouvenir(int teamID, const QString &item);
+
+private:
+	/*!
+	 * @brief Constructor; loads the tables
+	 */
+	Catalog();
+
+	// the hashes and comparisons are transparent, so the maps can be
+	// searched with views instead of building a QString key
+	struct NameHash {
+		using is_transparent = void;
+		size_t operator()(QStringView name) const { return qHash(name); }
+	};
+
+	struct NameEqual {
+		using is_transparent = void;
+		bool operator()(QStringView lhs, QStringView rhs) const { return lhs == rhs; }
+	};
+
+	struct SouvenirKey {
+		int teamID;
+		QString item;
+	};
+
+	struct SouvenirView {
+		SouvenirView(int teamID, QStringView item) : teamID{teamID}, item{item} {}
+		SouvenirView(const SouvenirKey &key) : teamID{key.teamID}, item{key.item} {}
+		int teamID;
+		QStringView item;
+	};
+
+	struct SouvenirHash {
+		using is_transparent = void;
+		size_t operator()(SouvenirView key) const
+		{ return qHash(key.item) ^ (size_t(key.teamID) * 0x9e3779b97f4a7c15ull); }
+	};
+
+	struct SouvenirEqual {
+		using is_transparent = void;
+		bool operator()(SouvenirView lhs, SouvenirView rhs) const
+		{ return lhs.teamID == rhs.teamID && lhs.item == rhs.item; }
+	};
+
+	// every lookup table is read far more than it is edited, so it trades
+	// memory for shorter probes
+	static constexpr float LOAD_FACTOR = 0.5f;
+
+	QStringList teamNames;	/// names ordered by id
+	nonstd::unordered_map<QString, int, NameHash, NameEqual> nameToID;	/// name -> id
+	nonstd::unordered_map<int, Team> teams;	/// id -> record
+	nonstd::unordered_map<int, QStringList> souvenirs;	/// id -> items in table order
+	nonstd::unordered_map<SouvenirKey, int, SouvenirHash, SouvenirEqual> prices;	/// (id, item) -> cents
+	Listing listings[int(ListOrder::Count)];	/// listed teams in every order
+
+	// key of a team in one listing
+	static ListKey Key(const Team &team, ListOrder order);
+};
+
+#endif // CATALOG_H
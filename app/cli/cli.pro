@@ -0,0 +1,24 @@
+# Headless planner; answers queries as JSON without a display
+
+TEMPLATE = app
+TARGET = planner_cli
+CONFIG += console c++17
+CONFIG -= app_bundle
+QT = core sql
+
+INCLUDEPATH += $$PWD/.. $$PWD/../include
+
+CORE_DIR = $$OUT_PWD/../core
+win32:CONFIG(release, debug|release): CORE_DIR = $$CORE_DIR/release
+else:win32:CONFIG(debug, debug|release): CORE_DIR = $$CORE_DIR/debug
+
+LIBS += -L$$CORE_DIR -lcore
+win32-g++|!win32: PRE_TARGETDEPS += $$CORE_DIR/libcore.a
+else: PRE_TARGETDEPS += $$CORE_DIR/core.lib
+
+SOURCES += \
+    main.cpp \
+    plannercli.cpp
+
+HEADERS += \
+    plannercli.h
@@ -0,0 +1,76 @@
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QTextStream>
+#include <QtSql/QSqlDatabase>
+#include "plannercli.h"
+#include "schema.h"
+
+int main(int argc, char *argv[])
+{
+	// QCoreApplication only locates the sql driver plugins; no event loop runs
+	QCoreApplication app(argc, argv);
+	QTextStream out(stdout);
+	QTextStream err(stderr);
+
+	QStringList args = app.arguments();
+	args.removeFirst();
+	QString dbName = QDir::currentPath() + "/Data.db";
+	bool batch = false;
+
+	while (!args.isEmpty() && args[0].startsWith("--")) {
+		QString option = args.takeFirst();
+		if (option == "--db" && !args.isEmpty()) {
+			dbName = args.takeFirst();
+		} else if (option == "--batch") {
+			batch = true;
+		} else {
+			err << PlannerCli::Usage();
+			return option == "--help" ? 0 : 2;
+		}
+	}
+	if (batch ? !args.isEmpty() : args.isEmpty()) {
+		err << PlannerCli::Usage();
+		return 2;
+	}
+
+	// opening a missing file would create an empty database
+	if (!QFileInfo::exists(dbName)) {
+		err << "planner_cli: no database at " << dbName << "\n";
+		return 1;
+	}
+	QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE");
+	db.setDatabaseName(dbName);
+	if (!db.open() || !Schema::Migrate(db)) {
+		err << "planner_cli: could not open " << dbName << "\n";
+		return 1;
+	}
+
+	PlannerCli cli;
+	if (!batch) {
+		QJsonObject answer = cli.Run(args);
+		out << QJsonDocument(answer).toJson(QJsonDocument::Compact) << "\n";
+		return answer.contains("error") ? 1 : 0;
+	}
+
+	// one JSON array per line in, one JSON object per line out
+	QTextStream in(stdin);
+	QString line;
+	while (in.readLineInto(&line)) {
+		if (line.trimmed().isEmpty())
+			continue;
+
+		QJsonDocument query = QJsonDocument::fromJson(line.toUtf8());
+		QStringList words;
+		for (const QJsonValue &word : query.array())
+			words.append(word.isDouble() ? QString::number(word.toInt()) : word.toString());
+
+		QJsonObject answer = query.isArray() ? cli.Run(words)
+			: QJsonObject{{"error", "expected a JSON array"}};
+		out << QJsonDocument(answer).toJson(QJsonDocument::Compact) << "\n";
+		out.flush();
+	}
+	return 0;
+}
@@ -0,0 +1,205 @@
+#include "plannercli.h"
+#include <QJsonArray>
+#include "catalog.h"
+#include "distancematrix.h"
+#include "graphDFS.h"
+#include "mstGraph.h"
+#include "tripplanner.h"
+
+namespace {
+	// names of a list of vertices
+	QJsonArray TeamNames(const StadiumGraph &graph, const std::vector<int> &vertices)
+	{
+		QJsonArray names;
+		for (int vertex : vertices)
+			names.append(graph.TeamName(vertex));
+		return names;
+	}
+}
+
+QString PlannerCli::Usage()
+{
+	return "usage: planner_cli [--db FILE] COMMAND [ARGS...]\n"
+		   "       planner_cli [--db FILE] --batch < queries\n"
+		   "\n"
+		   "commands:\n"
+		   "  teams                          every team name\n"
+		   "  path FROM TO                   shortest route between two teams\n"
+		   "  tour START TEAM...             shortest trip from START through every TEAM\n"
+		   "  mst [prim|kruskal]             minimum spanning tree of the stadiums\n"
+		   "  bfs START                      breadth first order and mileage\n"
+		   "  dfs START                      depth first order and mileage\n"
+		   "  shopping TEAM ITEM QTY...      cart total, one TEAM ITEM QTY triple per line item\n"
+		   "\n"
+		   "--batch reads one query per line as a JSON array, e.g.\n"
+		   "  [\"tour\", \"Arizona Cardinals\", \"Dallas Cowboys\", \"Denver Broncos\"]\n"
+		   "and writes one JSON answer per line. Prices are in cents.\n";
+}
+
+QJsonObject PlannerCli::Run(const QStringList &args)
+{
+	if (args.isEmpty())
+		return Error(QString(), "no command");
+
+	const QString &command = args[0];
+	if (command == "teams")
+		return Teams();
+	if (command == "path")
+		return Path(args);
+	if (command == "tour")
+		return Tour(args);
+	if (command == "mst")
+		return Mst(args);
+	if (command == "bfs")
+		return Bfs(args);
+	if (command == "dfs")
+		return Dfs(args);
+	if (command == "shopping")
+		return Shopping(args);
+	return Error(command, "unknown command");
+}
+
+QJsonObject PlannerCli::Error(const QString &command, const QString &message)
+{
+	return QJsonObject{{"command", command}, {"error", message}};
+}
+
+QJsonObject PlannerCli::Teams()
+{
+	return QJsonObject{{"command", "teams"},
+					   {"teams", QJsonArray::fromStringList(Catalog::instance()->TeamNames())}};
+}
+
+QJsonObject PlannerCli::Path(const QStringList &args)
+{
+	if (args.size() != 3)
+		return Error("path", "expected FROM TO");
+
+	std::shared_ptr<const DistanceMatrix> matrix = DistanceMatrix::instance();
+	const StadiumGraph &graph = matrix->Graph();
+	int from = graph.FindVertex(args[1]);
+	int to = graph.FindVertex(args[2]);
+	if (from == -1 || to == -1)
+		return Error("path", "unknown team: " + (from == -1 ? args[1] : args[2]));
+
+	std::vector<int> route = matrix->Route(from, to);
+	if (route.empty())
+		return Error("path", "no route between the teams");
+
+	return QJsonObject{{"command", "path"}, {"from", args[1]}, {"to", args[2]},
+					   {"distance", matrix->Distance(from, to)},
+					   {"route", TeamNames(graph, route)}};
+}
+
+QJsonObject PlannerCli::Tour(const QStringList &args)
+{
+	if (args.size() < 3)
+		return Error("tour", "expected START TEAM...");
+
+	std::shared_ptr<const DistanceMatrix> matrix = DistanceMatrix::instance();
+	const StadiumGraph &graph = matrix->Graph();
+	std::vector<int> vertices;
+	for (int i = 1; i < args.size(); i++) {
+		vertices.push_back(graph.FindVertex(args[i]));
+		if (vertices.back() == -1)
+			return Error("tour", "unknown team: " + args[i]);
+	}
+
+	TripPlanner planner(matrix);
+	std::vector<int> trip = planner.Optimize(vertices[0],
+			std::vector<int>(vertices.begin() + 1, vertices.end()));
+	long distance = planner.Length(trip);
+	if (distance < 0)
+		return Error("tour", "some stops are unreachable");
+
+	return QJsonObject{{"command", "tour"}, {"start", args[1]},
+					   {"distance", (qint64) distance},
+					   {"trip", TeamNames(graph, trip)}};
+}
+
+QJsonObject PlannerCli::Mst(const QStringList &args)
+{
+	QString name = args.size() > 1 ? args[1] : "prim";
+	if (args.size() > 2 || (name != "prim" && name != "kruskal"))
+		return Error("mst", "expected prim or kruskal");
+
+	std::shared_ptr<const StadiumGraph> graph = StadiumGraph::instance();
+	mstGraph tree(name == "kruskal" ? MstAlgorithm::Kruskal : MstAlgorithm::Prim);
+	vector<mstEdge> edges;
+	tree.GetMST(edges);
+
+	QJsonArray list;
+	for (const mstEdge &edge : edges)
+		list.append(QJsonObject{{"from", graph->TeamName(edge.start)},
+								{"to", graph->TeamName(edge.end)},
+								{"distance", edge.weight}});
+
+	return QJsonObject{{"command", "mst"}, {"algorithm", name},
+					   {"distance", (qint64) tree.GetMSTdistance()},
+					   {"edges", list}};
+}
+
+QJsonObject PlannerCli::Bfs(const QStringList &args)
+{
+	if (args.size() != 2)
+		return Error("bfs", "expected START");
+
+	std::shared_ptr<const StadiumGraph> graph = StadiumGraph::instance();
+	int vertex = graph->FindVertex(args[1]);
+	if (vertex == -1)
+		return Error("bfs", "unknown team: " + args[1]);
+
+	bfsEngine.bfsAlgo(graph->TeamID(vertex));
+	return QJsonObject{{"command", "bfs"}, {"start", args[1]},
+					   {"distance", bfsEngine.GetTotalDistance()},
+					   {"order", QJsonArray::fromStringList(bfsEngine.GetBfsList())}};
+}
+
+QJsonObject PlannerCli::Dfs(const QStringList &args)
+{
+	if (args.size() != 2)
+		return Error("dfs", "expected START");
+	if (StadiumGraph::instance()->FindVertex(args[1]) == -1)
+		return Error("dfs", "unknown team: " + args[1]);
+
+	dfs::GraphDFS<QString> graph;
+	graph.GenerateGraph();
+	std::vector<QString> order;
+	int distance = graph.dfs(args[1], order);
+
+	QJsonArray names;
+	for (const QString &name : order)
+		names.append(name);
+	return QJsonObject{{"command", "dfs"}, {"start", args[1]},
+					   {"distance", distance},
+					   {"backEdges", (int) graph.GetBackEdges().size()},
+					   {"order", names}};
+}
+
+QJsonObject PlannerCli::Shopping(const QStringList &args)
+{
+	if (args.size() < 4 || (args.size() - 1) % 3 != 0)
+		return Error("shopping", "expected TEAM ITEM QTY...");
+
+	Catalog *catalog = Catalog::instance();
+	QJsonArray items;
+	qint64 total = 0;
+	for (int i = 1; i < args.size(); i += 3) {
+		bool ok = false;
+		int quantity = args[i + 2].toInt(&ok);
+		if (!ok || quantity < 0)
+			return Error("shopping", "bad quantity: " + args[i + 2]);
+
+		int price = catalog->SouvenirPrice(catalog->TeamID(args[i]), args[i + 1]);
+		if (price == -1)
+			return Error("shopping", "no souvenir " + args[i + 1] + " at " + args[i]);
+
+		total += (qint64) price * quantity;
+		items.append(QJsonObject{{"team", args[i]}, {"item", args[i + 1]},
+								 {"quantity", quantity}, {"priceCents", price},
+								 {"subtotalCents", (qint64) price * quantity}});
+	}
+
+	return QJsonObject{{"command", "shopping"}, {"items", items},
+					   {"totalCents", total}};
+}
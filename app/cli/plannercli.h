@@ -0,0 +1,46 @@
+#ifndef PLANNERCLI_H
+#define PLANNERCLI_H
+
+#include <QJsonObject>
+#include <QStringList>
+#include "bfs.h"
+
+/*!
+ * @class PlannerCli
+ * @brief Answers planner queries for the command line tool. Every query is
+ * a command followed by its arguments and every answer is a JSON object
+ * echoing the command; failed queries carry an "error" member instead of
+ * a result. One instance can answer any number of queries, so batch runs
+ * reuse the loaded graph, distance matrix and catalog
+ */
+class PlannerCli {
+public:
+	/*!
+	 * @brief Answers one query
+	 * @param args; command followed by its arguments
+	 * @return JSON answer
+	 */
+	QJsonObject Run(const QStringList &args);
+
+	/*!
+	 * @brief Usage text listing the commands
+	 * @return QString
+	 */
+	static QString Usage();
+
+private:
+	QJsonObject Teams();
+	QJsonObject Path(const QStringList &args);
+	QJsonObject Tour(const QStringList &args);
+	QJsonObject Mst(const QStringList &args);
+	QJsonObject Bfs(const QStringList &args);
+	QJsonObject Dfs(const QStringList &args);
+	QJsonObject Shopping(const QStringList &args);
+
+	// answer for a failed query
+	static QJsonObject Error(const QString &command, const QString &message);
+
+	bfs bfsEngine;	/// reused by every bfs query
+};
+
+#endif // PLANNERCLI_H
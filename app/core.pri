@@ -0,0 +1,35 @@
+# Engine shared by the GUI, the core library and the command line planner.
+# Nothing here may depend on QtWidgets.
+
+INCLUDEPATH += $$PWD $$PWD/include
+
+SOURCES += \
+    $$PWD/bfs.cpp \
+    $$PWD/catalog.cpp \
+    $$PWD/csvreader.cpp \
+    $$PWD/distancematrix.cpp \
+    $$PWD/mstGraph.cpp \
+    $$PWD/schema.cpp \
+    $$PWD/shortestpath.cpp \
+    $$PWD/stadiumgraph.cpp \
+    $$PWD/tripplanner.cpp \
+    $$PWD/workerpool.cpp
+
+HEADERS += \
+    $$PWD/bfs.h \
+    $$PWD/bfsNamespace.h \
+    $$PWD/catalog.h \
+    $$PWD/csvreader.h \
+    $$PWD/distancematrix.h \
+    $$PWD/graph.h \
+    $$PWD/graphDFS.h \
+    $$PWD/include/flat_map.h \
+    $$PWD/include/hash_table.h \
+    $$PWD/include/swiss_table.h \
+    $$PWD/include/unordered_map.h \
+    $$PWD/mstGraph.h \
+    $$PWD/schema.h \
+    $$PWD/shortestpath.h \
+    $$PWD/stadiumgraph.h \
+    $$PWD/tripplanner.h \
+    $$PWD/workerpool.h
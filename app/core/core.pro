@@ -0,0 +1,8 @@
+# Static library of the graph, catalog and trip engines, without QtWidgets
+
+TEMPLATE = lib
+TARGET = core
+CONFIG += staticlib c++17
+QT = core sql
+
+include(../core.pri)
@@ -0,0 +1,115 @@
+#include "csvreader.h"
+#include <QDebug>
+
+CsvReader::CsvReader(const QString &fileName, char delimiter)
+	: file(fileName), delimiter{delimiter}
+{
+	if (!file.open(QIODevice::ReadOnly)) {
+		qDebug() << "CsvReader::CsvReader() : could not open" << fileName;
+		return;
+	}
+
+	const char *data = nullptr;
+	qint64 size = file.size();
+	if (size > 0)
+		data = reinterpret_cast<const char*>(file.map(0, size));
+	if (!data) {
+		// pipes and some file systems cannot be mapped
+		copy = file.readAll();
+		data = copy.constData();
+		size = copy.size();
+	}
+	begin = pos = data;
+	end = data + size;
+
+	// byte order mark written by spreadsheet exports
+	if (end - pos >= 3 && std::string_view(pos, 3) == "\xEF\xBB\xBF")
+		pos += 3;
+}
+
+bool CsvReader::Next()
+{
+	spans.clear();
+	fields.clear();
+	unescaped.clear();
+	if (failed)
+		return false;
+
+	while (pos < end && (*pos == '\n' || *pos == '\r')) {
+		if (*pos == '\n')
+			line++;
+		pos++;
+	}
+	if (pos >= end)
+		return false;
+
+	recordLine = line;
+	for (;;) {
+		if (!ReadField()) {
+			failed = true;
+			qDebug() << "CsvReader::Next() : malformed record on line" << recordLine;
+			return false;
+		}
+		if (pos < end && *pos == delimiter) {
+			pos++;
+			continue;
+		}
+		// end of record: \n, \r\n or end of file
+		if (pos < end && *pos == '\r')
+			pos++;
+		if (pos < end && *pos == '\n') {
+			pos++;
+			line++;
+		}
+		break;
+	}
+
+	// unescaped has stopped growing, so its views are stable now
+	fields.reserve(spans.size());
+	for (const Span &span : spans)
+		fields.emplace_back((span.buffered ? unescaped.data() : begin) + span.offset, span.size);
+	return true;
+}
+
+bool CsvReader::ReadField()
+{
+	if (pos >= end || *pos != '"') {
+		const char *start = pos;
+		while (pos < end && *pos != delimiter && *pos != '\n' && *pos != '\r')
+			pos++;
+		spans.push_back(Span{(size_t) (start - begin), (size_t) (pos - start), false});
+		return true;
+	}
+
+	const char *start = ++pos;
+	size_t offset = unescaped.size();
+	bool buffered = false;
+	for (;;) {
+		if (pos >= end)
+			return false;	// unterminated quote
+		if (*pos == '"') {
+			if (pos + 1 < end && pos[1] == '"') {
+				// keep one quote of the pair and continue after it
+				unescaped.append(start, pos - start + 1);
+				buffered = true;
+				pos += 2;
+				start = pos;
+				continue;
+			}
+			break;
+		}
+		if (*pos == '\n')
+			line++;
+		pos++;
+	}
+
+	if (buffered) {
+		unescaped.append(start, pos - start);
+		spans.push_back(Span{offset, unescaped.size() - offset, true});
+	} else {
+		spans.push_back(Span{(size_t) (start - begin), (size_t) (pos - start), false});
+	}
+	pos++;	// closing quote
+
+	return pos >= end || *pos == delimiter || *pos == '\n' || *pos == '\r';
+}
@@ -0,0 +1,111 @@
+#ifndef CSVREADER_H
+#define CSVREADER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+/*!
+ * @class CsvReader
+ * @brief Streams the records of an RFC 4180 csv file. The file is memory
+ * mapped and every field is a view into the mapping, so reading a record
+ * allocates nothing per field. Quoted fields may hold delimiters, line
+ * breaks and doubled quotes; only a field with doubled quotes is copied,
+ * unescaped, into a buffer owned by the reader.
+ *
+ * Fields are UTF-8 and stay valid until the next call to Next()
+ */
+class CsvReader {
+public:
+	/*!
+	 * @brief Opens and maps a file
+	 * @param fileName
+	 * @param delimiter; field separator
+	 */
+	explicit CsvReader(const QString &fileName, char delimiter = ',');
+
+	/*!
+	 * @brief Deleted copy constructor
+	 */
+	CsvReader(const CsvReader&) = delete;
+
+	/*!
+	 * @brief Deleted copy assignment
+	 */
+	CsvReader& operator=(const CsvReader&) = delete;
+
+	/*!
+	 * @brief whether the file could be opened
+	 * @return bool
+	 */
+	bool IsOpen() const { return file.isOpen(); }
+
+	/*!
+	 * @brief Advances to the next record. Blank lines are skipped
+	 * @return false at the end of the file or on a malformed record
+	 */
+	bool Next();
+
+	/*!
+	 * @brief whether reading stopped on a malformed record (an unterminated
+	 * quote or text after a closing quote)
+	 * @return bool
+	 */
+	bool Failed() const { return failed; }
+
+	/*!
+	 * @brief line of the file the current record starts on, 1 based
+	 * @return int
+	 */
+	int Line() const { return recordLine; }
+
+	/*!
+	 * @brief number of fields in the current record
+	 * @return int
+	 */
+	int Size() const { return fields.size(); }
+
+	/*!
+	 * @brief field of the current record without copying it
+	 * @param index; 0 <= index < Size()
+	 * @return UTF-8 view
+	 */
+	std::string_view Field(int index) const { return fields[index]; }
+
+	/*!
+	 * @brief field of the current record decoded to a QString
+	 * @param index; 0 <= index < Size()
+	 * @return QString
+	 */
+	QString Text(int index) const
+	{ return QString::fromUtf8(fields[index].data(), (int) fields[index].size()); }
+
+private:
+	// field as parsed; buffered fields live in unescaped, which may still grow
+	struct Span {
+		size_t offset;	/// from begin, or into unescaped when buffered
+		size_t size;
+		bool buffered;
+	};
+
+	// reads one quoted or plain field starting at pos
+	bool ReadField();
+
+	QFile file;
+	QByteArray copy;	/// file contents when mapping is not possible
+	const char *begin = nullptr;	/// mapped or copied contents
+	const char *pos = nullptr;	/// next unread byte
+	const char *end = nullptr;
+	char delimiter;
+	int line = 1;	/// line of pos
+	int recordLine = 0;
+	bool failed = false;
+	std::vector<Span> spans;
+	std::vector<std::string_view> fields;	/// current record
+	std::string unescaped;	/// fields that contained doubled quotes
+};
+
+#endif // CSVREADER_H
@@ -0,0 +1,192 @@
+#include "distancematrix.h"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <QDebug>
+#include <QtSql/QSqlDatabase>
+
+namespace {
+	std::shared_ptr<const DistanceMatrix> current;	/// matrix of the newest graph
+	std::mutex buildMutex;	/// one build at a time
+
+	const char SIDECAR_MAGIC[8] = {'N', 'F', 'L', 'D', 'M', 'A', 'T', '1'};
+
+	/*!
+	 * @brief layout of the sidecar file; followed by size * size distances
+	 * and size * size next hops as native ints
+	 */
+	struct SidecarHeader {
+		char magic[8];
+		qint32 size;	/// number of vertices
+		char checksum[20];	/// sha1 of the distance rows
+	};
+	static_assert(sizeof(SidecarHeader) % alignof(int) == 0,
+				  "tables must start int aligned");
+}
+
+std::shared_ptr<const DistanceMatrix> DistanceMatrix::instance()
+{
+	std::shared_ptr<const StadiumGraph> graph = StadiumGraph::instance();
+	std::shared_ptr<const DistanceMatrix> matrix = std::atomic_load(&current);
+
+	if (!matrix || matrix->Version() != graph->Version()) {
+		std::lock_guard<std::mutex> lock(buildMutex);
+		matrix = std::atomic_load(&current);
+		if (!matrix || matrix->Version() != graph->Version()) {
+			matrix = Load(graph, SidecarFileName());
+			if (!matrix) {
+				matrix = std::make_shared<const DistanceMatrix>(graph);
+				if (!matrix->Save(SidecarFileName()))
+					qDebug() << "DistanceMatrix::instance() : could not save" << SidecarFileName();
+			}
+			std::atomic_store(&current, matrix);
+		}
+	}
+	return matrix;
+}
+
+QString DistanceMatrix::SidecarFileName()
+{
+	return QSqlDatabase::database().databaseName() + ".matrix";
+}
+
+DistanceMatrix::DistanceMatrix(std::shared_ptr<const StadiumGraph> stadiums)
+	: graph{std::move(stadiums)}, size{graph->Size()},
+	  buffer((size_t) 2 * size * size), distances{buffer.data()},
+	  nextHops{buffer.data() + (size_t) size * size}
+{
+	std::fill(buffer.begin(), buffer.begin() + (size_t) size * size, ShortestPath::UNREACHABLE);
+	std::fill(buffer.begin() + (size_t) size * size, buffer.end(), -1);
+
+	// one dijkstra per source; rows are independent so split them by thread
+	int threads = std::max(1, std::min<int>(std::thread::hardware_concurrency(), size / 16));
+	if (threads == 1) {
+		BuildRows(0, size);
+		return;
+	}
+
+	std::vector<std::thread> workers;
+	int rowsPerThread = (size + threads - 1) / threads;
+	for (int first = 0; first < size; first += rowsPerThread)
+		workers.emplace_back(&DistanceMatrix::BuildRows, this, first,
+							 std::min(size, first + rowsPerThread));
+	for (auto &worker : workers)
+		worker.join();
+}
+
+DistanceMatrix::DistanceMatrix(std::shared_ptr<const StadiumGraph> stadiums,
+							   std::unique_ptr<QFile> mapped, const int *tables)
+	: graph{std::move(stadiums)}, size{graph->Size()}, file{std::move(mapped)},
+	  distances{tables}, nextHops{tables + (size_t) size * size} {}
+
+std::shared_ptr<const DistanceMatrix> DistanceMatrix::Load(
+		std::shared_ptr<const StadiumGraph> graph, const QString &fileName)
+{
+	const QByteArray &checksum = graph->Checksum();
+	if (checksum.size() != sizeof(SidecarHeader::checksum))
+		return nullptr;
+
+	std::unique_ptr<QFile> file(new QFile(fileName));
+	if (!file->open(QIODevice::ReadOnly))
+		return nullptr;
+
+	size_t cells = (size_t) graph->Size() * graph->Size();
+	qint64 length = sizeof(SidecarHeader) + 2 * cells * sizeof(int);
+	if (file->size() != length)
+		return nullptr;
+
+	uchar *data = file->map(0, length);
+	if (!data)
+		return nullptr;
+
+	const SidecarHeader *header = reinterpret_cast<const SidecarHeader*>(data);
+	if (std::memcmp(header->magic, SIDECAR_MAGIC, sizeof(SIDECAR_MAGIC)) != 0 ||
+		header->size != graph->Size() ||
+		std::memcmp(header->checksum, checksum.constData(), checksum.size()) != 0)
+		return nullptr;	// stale sidecar, closing the file unmaps it
+
+	const int *tables = reinterpret_cast<const int*>(data + sizeof(SidecarHeader));
+	return std::shared_ptr<const DistanceMatrix>(
+			new DistanceMatrix(std::move(graph), std::move(file), tables));
+}
+
+bool DistanceMatrix::Save(const QString &fileName) const
+{
+	const QByteArray &checksum = graph->Checksum();
+	if (checksum.size() != sizeof(SidecarHeader::checksum))
+		return false;
+
+	SidecarHeader header{};
+	std::memcpy(header.magic, SIDECAR_MAGIC, sizeof(SIDECAR_MAGIC));
+	header.size = size;
+	std::memcpy(header.checksum, checksum.constData(), checksum.size());
+
+	// QSaveFile renames into place on commit so readers never see half a file
+	qint64 tableBytes = (qint64) size * size * sizeof(int);
+	QSaveFile out(fileName);
+	if (!out.open(QIODevice::WriteOnly))
+		return false;
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	out.write(reinterpret_cast<const char*>(distances), tableBytes);
+	out.write(reinterpret_cast<const char*>(nextHops), tableBytes);
+	return out.commit();
+}
+
+void DistanceMatrix::BuildRows(int first, int last)
+{
+	ShortestPath paths(graph->Csr());
+	int *distanceTable = buffer.data();
+	int *nextTable = buffer.data() + (size_t) size * size;
+
+	for (int source = first; source < last; source++) {
+		paths.Run(source);
+
+		int *distanceRow = distanceTable + (size_t) source * size;
+		int *nextRow = nextTable + (size_t) source * size;
+
+		// a vertex's parent is settled before it, so its next hop is known
+		for (int vertex : paths.Order()) {
+			int parent = paths.Parent(vertex);
+			distanceRow[vertex] = paths.Cost(vertex);
+			if (parent != -1)
+				nextRow[vertex] = parent == source ? vertex : nextRow[parent];
+		}
+	}
+}
+
+std::vector<int> DistanceMatrix::Route(int from, int to) const
+{
+	std::vector<int> route;
+
+	if (Distance(from, to) == ShortestPath::UNREACHABLE)
+		return route;
+
+	// hops chain different sources' trees, which only agree when every
+	// edge is longer than 0; zero mile ties can send two trees at each
+	// other, so a route longer than the vertex count is given up on
+	route.push_back(from);
+	for (int vertex = from; vertex != to; ) {
+		vertex = NextHop(vertex, to);
+		if (vertex == -1 || (int) route.size() == size) {
+			qDebug() << "DistanceMatrix::Route() : no route from" << from << "to" << to;
+			return std::vector<int>();
+		}
+		route.push_back(vertex);
+	}
+
+	return route;
+}
+
+long DistanceMatrix::TripDistance(const std::vector<int> &stops) const
+{
+	long total = 0;
+
+	for (int i = 1; i < (int) stops.size(); i++) {
+		int leg = Distance(stops[i - 1], stops[i]);
+		if (leg == ShortestPath::UNREACHABLE)
+			return -1;
+		total += leg;
+	}
+	return total;
+}
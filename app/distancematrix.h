@@ -0,0 +1,136 @@
+#ifndef DISTANCEMATRIX_H
+#define DISTANCEMATRIX_H
+
+#include <memory>
+#include <vector>
+#include <QFile>
+#include <QSaveFile>
+#include <QString>
+#include "stadiumgraph.h"
+#include "shortestpath.h"
+
+/*!
+ * @class DistanceMatrix
+ * @brief All-pairs shortest distances and next hops for one StadiumGraph
+ * snapshot. Built lazily by running ShortestPath from every source in
+ * parallel; instance() rebuilds it when the graph version changes.
+ *
+ * Built matrices are saved to a sidecar file next to Data.db together with
+ * the graph's checksum. On startup the sidecar is memory mapped and used in
+ * place as long as the checksum still matches the distance table
+ */
+class DistanceMatrix {
+public:
+	/*!
+	 * @brief Matrix for the current stadium graph, built on first use and
+	 * again after StadiumGraph::Rebuild()
+	 * @return shared pointer to the matrix
+	 */
+	static std::shared_ptr<const DistanceMatrix> instance();
+
+	/*!
+	 * @brief Builds the matrix for a graph snapshot
+	 * @param graph; snapshot to precompute
+	 */
+	explicit DistanceMatrix(std::shared_ptr<const StadiumGraph> graph);
+
+	/*!
+	 * @brief Maps a saved matrix for a graph snapshot without copying it
+	 * @param graph; snapshot the matrix must belong to
+	 * @param fileName; sidecar written by Save()
+	 * @return matrix, nullptr if the file is missing, malformed or was
+	 * saved for different distance rows
+	 */
+	static std::shared_ptr<const DistanceMatrix> Load(
+			std::shared_ptr<const StadiumGraph> graph, const QString &fileName);
+
+	/*!
+	 * @brief Writes the matrix and the graph checksum to a sidecar file
+	 * @param fileName
+	 * @return bool; true if the file was written
+	 */
+	bool Save(const QString &fileName) const;
+
+	/*!
+	 * @brief Sidecar location, next to the database file
+	 * @return file name
+	 */
+	static QString SidecarFileName();
+
+	/*!
+	 * @brief Deleted copy constructor
+	 */
+	DistanceMatrix(const DistanceMatrix&) = delete;
+
+	/*!
+	 * @brief Deleted copy assignment
+	 */
+	DistanceMatrix& operator=(const DistanceMatrix&) = delete;
+
+	/*!
+	 * @brief graph snapshot the matrix was built from
+	 * @return StadiumGraph
+	 */
+	const StadiumGraph &Graph() const { return *graph; }
+
+	/*!
+	 * @brief version of the graph the matrix was built from
+	 * @return version number
+	 */
+	unsigned Version() const { return graph->Version(); }
+
+	/*!
+	 * @brief number of vertices
+	 * @return int
+	 */
+	int Size() const { return size; }
+
+	/*!
+	 * @brief shortest distance between two vertices, O(1)
+	 * @param from; vertex index
+	 * @param to; vertex index
+	 * @return distance, ShortestPath::UNREACHABLE if there is no path
+	 */
+	int Distance(int from, int to) const { return distances[(size_t) from * size + to]; }
+
+	/*!
+	 * @brief first vertex after from on the shortest path to to, O(1)
+	 * @param from; vertex index
+	 * @param to; vertex index
+	 * @return vertex index, -1 if from == to or to is unreachable
+	 */
+	int NextHop(int from, int to) const { return nextHops[(size_t) from * size + to]; }
+
+	/*!
+	 * @brief shortest route between two vertices, O(path length)
+	 * @param from; vertex index
+	 * @param to; vertex index
+	 * @return vertices from from to to, empty if unreachable or the
+	 * next hops do not lead to to
+	 */
+	std::vector<int> Route(int from, int to) const;
+
+	/*!
+	 * @brief total distance of visiting the vertices in the given order
+	 * @param stops; vertex indices
+	 * @return distance, -1 if a leg is unreachable
+	 */
+	long TripDistance(const std::vector<int> &stops) const;
+
+private:
+	// fills the rows of sources [first, last) with their own engine
+	void BuildRows(int first, int last);
+
+	// wraps tables that live in a mapped sidecar
+	DistanceMatrix(std::shared_ptr<const StadiumGraph> graph,
+				   std::unique_ptr<QFile> file, const int *tables);
+
+	std::shared_ptr<const StadiumGraph> graph;	/// snapshot kept alive
+	int size;
+	std::vector<int> buffer;	/// owned tables when built in memory
+	std::unique_ptr<QFile> file;	/// owns the mapping when loaded from disk
+	const int *distances;	/// row major, size * size
+	const int *nextHops;	/// row major, size * size
+};
+
+#endif // DISTANCEMATRIX_H
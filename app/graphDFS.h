@@ -1,418 +1,324 @@
-#ifndef GRAPHDFS_H
-#define GRAPHDFS_H
-
-#include <vector>
-#include <iostream>
-#include <algorithm>
-#include "dbmanager.h"
-
-namespace dfs {
-/*!
- * \brief The Edge struct
- */
-template<typename T>
-struct Edge {
-	T u;	/// start
-	T v;	/// end
-    bool discoverEdge;
-    int weight;
-
-    /***************************************************************
-     * Edge();
-     *   Constructor; Initialize class attributes
-     *   Parameters: none
-     *   Return: none
-     ***************************************************************/
-    Edge(): u{""}, v{""}, discoverEdge{false}, weight{0} {}
-
-    /***************************************************************
-     * Edge(T u, T v, int weight)
-     *   Constructor; Initialize class attributes
-     *   Parameters: none
-     *   Return: none
-     ***************************************************************/
-    Edge(T u, T v, int weight)
-    : u{u}, v{v}, discoverEdge{false}, weight{weight} {}
-
-    bool operator==(const Edge<T> &rhs) const
-    {
-        return u == rhs.v && v == rhs.u;
-    }
-
-    bool operator!=(const Edge<T> &rhs) const { return !(this == rhs); }
-};
-
-template<typename T>
-/*!
- * \brief The Vertex struct
- */
-struct Vertex {
-    T vert;
-    bool visited;
-    std::vector<Edge<T>> edgeList;
-
-    /***************************************************************
-     * Vertex();
-     *   Constructor; Initialize class attributes
-     *   Parameters: none
-     *   Return: none
-     ***************************************************************/
-    Vertex(): vert{T{}}, visited{false} {}
-
-    /***************************************************************
-     * Vertex(T vert, bool visited)
-     *   Constructor; Initialize class attributes
-     *   Parameters: none
-     *   Return: none
-     ***************************************************************/
-    Vertex(T vert, bool visited): vert{vert}, visited{visited} {}
-
-    /*******************************************************************
-     * int NumOfEdges() const
-     *
-     *   Accessor; number of edges
-     *------------------------------------------------------------------
-     *   Parameter: (none)
-     *------------------------------------------------------------------
-     *   Return: (int) - number of edges
-     *******************************************************************/
-    int NumOfEdges() const { return edgeList.size(); }
-};
-
-template<typename T>
-/*!
- * \brief The Graph class with dijkstra logic
- */
-class GraphDFS {
-public:
-	/*!
-	 * \brief Graph constructor
-	 */
-	GraphDFS() : dfsDistance{0} {}
-
-	/*!
-	 * \brief Graph destructor
-	 */
-	~GraphDFS() = default;
-
-	/*!
-	 * \brief generateGraph from db
-	 */
-	void GenerateGraph()
-	{
-		QSqlQuery query;
-		QString queryString = "SELECT id,distanceTo "
-							  "FROM distance "
-							  "WHERE beginStadium "
-							  "IN(SELECT endStadium FROM distance WHERE id = :id) "
-							  "AND endStadium = (SELECT beginStadium FROM distance WHERE id = :id) "
-							  "AND id!=:id ";
-
-		query.prepare(queryString);
-
-		if constexpr (std::is_same<T, QString>::value) {
-			QStringList teams;
-			DBManager::instance()->GetTeams(teams);
-
-			for (int i = 1; i <= teams.size(); i++) {
-				AddVertex(teams[i - 1]);
-				query.bindValue(":id", i);
-				if(!query.exec()) {
-					qDebug() << "DBManager::generateGraph vertex: " << i << " failed";
-				} else {
-					while(query.next())
-						AddEdge(teams[i - 1], teams[query.value(0).toInt() - 1], query.value(1).toInt());
-				}
-			}
-		} else if constexpr (std::is_same<T, int>::value) {
-			int numTeams = DBManager::instance()->GetNumTeams();
-
-			int i = 1;
-			while (i <= numTeams) {
-				AddVertex(i);
-				query.bindValue(":id", i);
-				if(!query.exec()) {
-					qDebug() << "DBManager::generateGraph vertex: " << i << " failed";
-				} else {
-					while(query.next())
-						AddEdge(i, query.value(0).toInt(), query.value(1).toInt());
-					i++;
-				}
-			}
-		}
-	}
-
-
-	/*!
-	 * \brief checks if graph is empty
-	 * \return bool
-	 */
-	bool Empty() const { return graph.empty(); }
-
-	/*!
-	 * \brief size of graph
-	 * \return int
-	 */
-	int Size() const { return graph.size(); }
-
-	/*!
-	 * \brief addVertex
-	 * \param vert; type T
-	 */
-	void AddVertex(T vert) {
-		if (FindVertex(vert) == -1)
-			graph.push_back(Vertex<T>{vert, false});
-	}
-
-	/*!
-	 * \brief addEdge
-	 * \param u; starting vert
-	 * \param v; ending vert
-	 * \param weight; "distance"
-	 */
-	void AddEdge(T u, T v, int weight) {
-		int index = FindVertex(u);
-
-		if (index == -1) {
-			AddVertex(u);
-			AddEdge(u, v, weight);
-		} else {
-			graph.at(index).edgeList.push_back(Edge<T>{u, v, weight});
-		}
-	}
-
-	/*!
-	 * \brief findVertex
-	 * \param vert
-	 * \return index in graph container
-	 */
-	int FindVertex(T vert) const {
-		int index = 0;
-
-		while (index < Size()) {
-			if (graph.at(index).vert == vert)
-				return index;
-			index++;
-		}
-		return -1;
-	}
-
-	/*!
-	 * \brief vertices
-	 * \return list of vertices in graph
-	 */
-	std::vector<T> Vertices() const {
-		std::vector<T> temp;
-		for (auto a: graph)
-			temp.push_back(a.vert);
-		return temp;
-	}
-
-	/*!
-	 * \brief edges
-	 * \return list of edges in graph
-	 */
-	std::vector<std::string> Edges() const {
-		std::vector<std::string> temp;
-		for (int i = 0; i < Size(); i++) {
-			if (graph.at(i).NumOfEdges() != 0) {
-				for (unsigned int j = 0;
-					 j < graph.at(i).NumOfEdges(); j++) {
-					temp.push_back("(" + graph.at(i).edgeList.at(j).u + ", "
-								   + graph.at(i).edgeList.at(j).v + ")");
-				}
-			}
-		}
-		return temp;
-	}
-
-	/*!
-	 * \brief dfs depth first search
-	 * \param start
-	 * \param list
-	 * \return total distance "cost"
-	 */
-	int dfs(T start, std::vector<T> &list) {
-		int index = FindVertex(start);
-		graph.at(index).visited = true;
-
-		typename std::vector<T>::iterator itrNext = std::find(list.begin(),
-															  list.end(),
-															  start);
-
-		if (itrNext == list.end())
-			list.push_back(start);
-
-		if (VerticesVisited() != Size()) {
-			int next = SmallestEdgeDFS(index, list);
-			dfs(graph.at(next).vert, list);
-		}
-		return dfsDistance;
-	}
-
-	/*!
-	 * \brief getDiscoveryEdges
-	 * \param dfs
-	 * \return list of discovery edges
-	 */
-	std::vector<std::string> GetDiscoveryEdges(const std::vector<T> &dfs) {
-		std::vector<Edge<T>> discEdges;
-
-		for (int i = 0; i < Size(); i++) {
-			int index = FindVertex(dfs.at(i));
-			for (int j = 0; j < graph.at(index).NumOfEdges(); j++) {
-				if (graph.at(index).edgeList.at(j).discoverEdge)
-					discEdges.push_back(graph.at(index).edgeList.at(j));
-			}
-		}
-
-		RemoveDuplicates(discEdges);
-		typename std::vector<Edge<T>>::iterator itr = discEdges.begin();
-
-		std::vector<std::string> discoveryEdges;
-
-		while (itr != discEdges.end()) {
-			discoveryEdges.push_back("(" + itr->u + ", " + itr->v + ")");
-			itr++;
-		}
-
-		return discoveryEdges;
-	}
-
-	/*!
-	 * \brief getBackEdges
-	 * \param dfs; list containing dfs list
-	 * \return list of back edges
-	 */
-	std::vector<std::string> GetBackEdges(const std::vector<T> &dfs) {
-		std::vector<Edge<T>> backEdges;
-
-		for (int i = 0; i < Size(); i++) {
-			int index = FindVertex(dfs.at(i));
-			for (int j = 0; j < graph.at(index).NumOfEdges(); j++) {
-				if (!(graph.at(index).edgeList.at(j).discoverEdge))
-					backEdges.push_back(graph.at(index).edgeList.at(j));
-			}
-		}
-
-		RemoveDuplicates(backEdges);
-		typename std::vector<Edge<T>>::iterator itr = backEdges.begin();
-
-		std::vector<std::string> finalBackEdgeList;
-
-		while (itr != backEdges.end()) {
-			finalBackEdgeList.push_back("(" + itr->u + ", " + itr->v + ")");
-			itr++;
-		}
-
-		return finalBackEdgeList;
-	}
-
-private:
-	// returns the index of the next smallest weighted path from vert
-	// recursively backtracks if none is found
-	int SmallestEdgeDFS(int vert, std::vector<T> &dfs) {
-		if (EdgesDiscovered(vert) != graph.at(vert).NumOfEdges()) {
-			int smallestIndex = 0;
-			int compIndex = smallestIndex + 1;
-			int size = graph.at(vert).NumOfEdges();
-
-			while (compIndex < size) {
-				int smallestVert = FindVertex(
-						graph.at(vert).edgeList.at(smallestIndex).v);
-				int compVertex = FindVertex(
-						graph.at(vert).edgeList.at(compIndex).v);
-
-				if (graph.at(smallestVert).visited) {
-					smallestIndex++;
-				} else {
-					if (!(graph.at(compVertex).visited)) {
-						if (graph.at(vert).edgeList.at(
-								smallestIndex).weight >=
-							graph.at(vert).edgeList.at(compIndex).weight)
-							smallestIndex = compIndex;
-					}
-				}
-				compIndex++;
-			}
-
-			graph.at(vert).edgeList.at(smallestIndex).discoverEdge = true;
-
-			dfsDistance += graph.at(vert).edgeList.at(smallestIndex).weight;
-
-			T next = graph.at(vert).edgeList.at(smallestIndex).v;
-
-			smallestIndex = FindVertex(next);
-
-			for (int i = 0; i < graph.at(smallestIndex).NumOfEdges(); i++) {
-				if (graph.at(vert).vert ==
-					graph.at(smallestIndex).edgeList.at(i).v) {
-					graph.at(smallestIndex).edgeList.at(
-							i).discoverEdge = true;
-				}
-			}
-
-			return smallestIndex;
-		} else {
-			typename std::vector<T>::iterator itr =
-					std::find(dfs.begin(), dfs.end(), graph.at(vert).vert);
-			itr--;
-			int backIndex = FindVertex(*itr);
-			return SmallestEdgeDFS(backIndex, dfs);
-		}
-	}
-
-	// returns the number of verts visited
-	// used to check if search is completed
-	int VerticesVisited() {
-		std::size_t count = 0;
-
-		typename std::vector<Vertex<T>>::iterator itr = graph.begin();
-
-		while (itr != graph.end()) {
-			if (itr->visited)
-				count++;
-			itr++;
-		}
-		return count;
-	}
-
-	// returns the number of edges visited
-	// returns 0 is nothing found
-	int EdgesDiscovered(int currVertex) {
-		int numVisited = 0;
-
-		for (int i = 0; i < graph.at(currVertex).NumOfEdges(); i++) {
-			if (graph.at(FindVertex(
-					graph.at(currVertex).edgeList.at(i).v)).visited)
-				numVisited++;
-		}
-		return numVisited;
-	}
-
-	// removes duplicates from the discovery edges method and
-	// the backedges method. This occurs because edges can go both ways
-	void RemoveDuplicates(std::vector<Edge<T>> &vec) {
-		typename std::vector<Edge<T>>::iterator itr = vec.begin();
-
-		while (itr != vec.end()) {
-			typename std::vector<Edge<T>>::iterator compIt = itr + 1;
-			bool deleted = false;
-
-			while (compIt != vec.end() && !deleted) {
-				if (itr->u == compIt->v && itr->v == compIt->u) {
-					vec.erase(compIt);
-					deleted = true;
-				} else {
-					compIt++;
-				}
-			}
-			itr++;
-		}
-	}
-
-	std::vector<Vertex<T>> graph;	/// graph container
-	int dfsDistance;
-};
-}
-#endif //GRAPHDFS_H
+#ifndef GRAPHDFS_H
+#define GRAPHDFS_H
+
+#include <vector>
+#include <iostream>
+#include <QString>
+#include <algorithm>
+#include "stadiumgraph.h"
+#include "bfsNamespace.h"
+#include "unordered_map.h"
+
+namespace dfs {
+/*!
+ * \brief The Edge struct
+ */
+template<typename T>
+struct Edge {
+	T u;	/// start
+	T v;	/// end
+    bool discoverEdge;
+    int weight;
+
+    /***************************************************************
+     * Edge();
+     *   Constructor; Initialize class attributes
+     *   Parameters: none
+     *   Return: none
+     ***************************************************************/
+    Edge(): u{}, v{}, discoverEdge{false}, weight{0} {}
+
+    /***************************************************************
+     * Edge(T u, T v, int weight)
+     *   Constructor; Initialize class attributes
+     *   Parameters: none
+     *   Return: none
+     ***************************************************************/
+    Edge(T u, T v, int weight, bool discoverEdge = false)
+    : u{u}, v{v}, discoverEdge{discoverEdge}, weight{weight} {}
+
+    bool operator==(const Edge<T> &rhs) const
+    {
+        return u == rhs.v && v == rhs.u;
+    }
+
+    bool operator!=(const Edge<T> &rhs) const { return !(*this == rhs); }
+};
+
+/*!
+ * \brief formats an edge for display as "(u, v)"
+ * \param edge
+ * \return QString
+ */
+template<typename T>
+QString EdgeToString(const Edge<T> &edge)
+{
+	if constexpr (std::is_same<T, QString>::value)
+		return "(" + edge.u + ", " + edge.v + ")";
+	else
+		return "(" + QString::number(edge.u) + ", " + QString::number(edge.v) + ")";
+}
+
+template<typename T>
+/*!
+ * \brief The Graph class with dijkstra logic
+ */
+class GraphDFS {
+public:
+	/*!
+	 * \brief Graph constructor
+	 */
+	GraphDFS() : adjacencyValid{false}, dfsDistance{0} {}
+
+	/*!
+	 * \brief Graph destructor
+	 */
+	~GraphDFS() = default;
+
+	/*!
+	 * \brief generateGraph from the shared stadium graph
+	 */
+	void GenerateGraph()
+	{
+		std::shared_ptr<const StadiumGraph> stadiums = StadiumGraph::instance();
+
+		for (int i = 0; i < stadiums->Size(); i++) {
+			if constexpr (std::is_same<T, QString>::value) {
+				AddVertex(stadiums->TeamName(i));
+				for (const auto &edge : stadiums->Adjacent(i))
+					AddEdge(stadiums->TeamName(i), stadiums->TeamName(edge.end), edge.weight);
+			} else if constexpr (std::is_same<T, int>::value) {
+				AddVertex(stadiums->TeamID(i));
+				for (const auto &edge : stadiums->Adjacent(i))
+					AddEdge(stadiums->TeamID(i), stadiums->TeamID(edge.end), edge.weight);
+			}
+		}
+	}
+
+
+	/*!
+	 * \brief checks if graph is empty
+	 * \return bool
+	 */
+	bool Empty() const { return vertices.empty(); }
+
+	/*!
+	 * \brief size of graph
+	 * \return int
+	 */
+	int Size() const { return vertices.size(); }
+
+	/*!
+	 * \brief addVertex
+	 * \param vert; type T
+	 */
+	void AddVertex(T vert) {
+		if (FindVertex(vert) == -1) {
+			vertexIndex.insert({vert, Size()});
+			vertices.push_back(vert);
+			edgeLists.emplace_back();
+			adjacencyValid = false;
+		}
+	}
+
+	/*!
+	 * \brief addEdge
+	 * \param u; starting vert
+	 * \param v; ending vert
+	 * \param weight; "distance"
+	 */
+	void AddEdge(T u, T v, int weight) {
+		AddVertex(u);
+		AddVertex(v);
+		edgeLists[FindVertex(u)].push_back(generalContainer::node{FindVertex(v), weight});
+		adjacencyValid = false;
+	}
+
+	/*!
+	 * \brief findVertex
+	 * \param vert
+	 * \return id of the vertex, -1 if it is not in the graph
+	 */
+	int FindVertex(T vert) const {
+		auto found = vertexIndex.find(vert);
+		return found == vertexIndex.end() ? -1 : found->second;
+	}
+
+	/*!
+	 * \brief vertices
+	 * \return list of vertices in graph
+	 */
+	std::vector<T> Vertices() const { return vertices; }
+
+	/*!
+	 * \brief edges
+	 * \return list of edges in graph, format with EdgeToString
+	 */
+	std::vector<Edge<T>> Edges() const {
+		std::vector<Edge<T>> temp;
+		for (int i = 0; i < Size(); i++)
+			for (const auto &edge : edgeLists[i])
+				temp.push_back(Edge<T>{vertices[i], vertices[edge.end], edge.weight});
+		return temp;
+	}
+
+	/*!
+	 * \brief dfs depth first search, always following the shortest edge to
+	 * an unvisited vertex; iterative, O(V + E)
+	 * \param start
+	 * \param list; receives the vertices in visiting order
+	 * \return total distance "cost", 0 if start is not in the graph
+	 */
+	int dfs(T start, std::vector<T> &list) {
+		dfsDistance = 0;
+		int first = FindVertex(start);
+		if (first == -1)
+			return dfsDistance;
+		if (!adjacencyValid)
+			BuildAdjacency();
+
+		visited.assign(Size(), false);
+		discovered.assign(pairCount, false);
+		discoveryEdges.clear();
+
+		// each frame is a vertex and the next of its edges to look at, so
+		// every edge is looked at once per search
+		std::vector<std::pair<int, int>> stack;
+		stack.reserve(Size());
+		stack.push_back({first, adjacency.offsets[first]});
+		visited[first] = true;
+		list.push_back(start);
+
+		while (!stack.empty()) {
+			int vert = stack.back().first;
+			int &next = stack.back().second;
+
+			while (next < adjacency.offsets[vert + 1] && visited[adjacency.edges[next].end])
+				next++;
+
+			if (next == adjacency.offsets[vert + 1]) {	// backtrack
+				stack.pop_back();
+				continue;
+			}
+
+			int edge = next++;
+			int to = adjacency.edges[edge].end;
+			discovered[pairOf[edge]] = true;
+			discoveryEdges.push_back(Edge<T>{vertices[vert], vertices[to], adjacency.edges[edge].weight, true});
+			dfsDistance += adjacency.edges[edge].weight;
+			visited[to] = true;
+			list.push_back(vertices[to]);
+			stack.push_back({to, adjacency.offsets[to]});
+		}
+		return dfsDistance;
+	}
+
+	/*!
+	 * \brief getDiscoveryEdges
+	 * \return discovery edges of the last dfs in the order they were
+	 * followed, format with EdgeToString
+	 */
+	const std::vector<Edge<T>> &GetDiscoveryEdges() const { return discoveryEdges; }
+
+	/*!
+	 * \brief getBackEdges; every edge between visited vertices that the last
+	 * dfs did not follow, reported once per pair of vertices. O(E)
+	 * \return list of back edges, format with EdgeToString
+	 */
+	std::vector<Edge<T>> GetBackEdges() const {
+		std::vector<Edge<T>> backEdges;
+		if ((int) discovered.size() != pairCount)
+			return backEdges;
+
+		std::vector<bool> reported(pairCount, false);
+		for (int vert = 0; vert < Size(); vert++) {
+			if (!visited[vert])
+				continue;
+			for (int edge = adjacency.offsets[vert]; edge < adjacency.offsets[vert + 1]; edge++) {
+				int pair = pairOf[edge];
+				int to = adjacency.edges[edge].end;
+				if (discovered[pair] || reported[pair] || !visited[to] || to == vert)
+					continue;
+				reported[pair] = true;
+				backEdges.push_back(Edge<T>{vertices[vert], vertices[to], adjacency.edges[edge].weight});
+			}
+		}
+		return backEdges;
+	}
+
+private:
+	struct VertexHash {
+		size_t operator()(const T &vert) const {
+			if constexpr (std::is_same<T, QString>::value)
+				return qHash(vert);
+			else
+				return std::hash<T>{}(vert);
+		}
+	};
+
+	// packs the edge lists into adjacency, each vertex's edges shortest
+	// first; equal weights keep the later edge first like the old search
+	void BuildAdjacency() {
+		std::vector<std::vector<generalContainer::node>> sorted(edgeLists);
+		for (auto &list : sorted) {
+			std::reverse(list.begin(), list.end());
+			std::stable_sort(list.begin(), list.end(),
+							 [](const generalContainer::node &a, const generalContainer::node &b) {
+								 return a.weight < b.weight;
+							 });
+		}
+		adjacency.build(sorted);
+
+		// both directions of an edge share the id of (min, max). Rows are
+		// walked in vertex order: a row numbers its edges to later vertices
+		// and passes each id on to the later vertex's row through lower,
+		// which that row spreads into pairIdOf before looking at its own
+		// edges. Every edge is handled a constant number of times, O(V + E)
+		std::vector<int> lowerOffsets(Size() + 1, 0);
+		for (int vert = 0; vert < Size(); vert++)
+			for (int edge = adjacency.offsets[vert]; edge < adjacency.offsets[vert + 1]; edge++)
+				if (adjacency.edges[edge].end > vert)
+					lowerOffsets[adjacency.edges[edge].end + 1]++;
+		for (int vert = 0; vert < Size(); vert++)
+			lowerOffsets[vert + 1] += lowerOffsets[vert];
+
+		std::vector<std::pair<int, int>> lower(lowerOffsets.back());	// (earlier vertex, pair id) by later vertex
+		std::vector<int> lowerFill(lowerOffsets.begin(), lowerOffsets.end() - 1);
+		std::vector<int> owner(Size(), -1);	// vertex -> row that last set pairIdOf
+		std::vector<int> pairIdOf(Size());	// vertex -> id of its pair with the current row
+
+		pairOf.resize(adjacency.edges.size());
+		pairCount = 0;
+		for (int vert = 0; vert < Size(); vert++) {
+			for (int i = lowerOffsets[vert]; i < lowerFill[vert]; i++) {
+				owner[lower[i].first] = vert;
+				pairIdOf[lower[i].first] = lower[i].second;
+			}
+			for (int edge = adjacency.offsets[vert]; edge < adjacency.offsets[vert + 1]; edge++) {
+				int to = adjacency.edges[edge].end;
+				if (owner[to] != vert) {	// first edge of this pair
+					owner[to] = vert;
+					pairIdOf[to] = pairCount++;
+					if (to > vert)
+						lower[lowerFill[to]++] = {vert, pairIdOf[to]};
+				}
+				pairOf[edge] = pairIdOf[to];
+			}
+		}
+		adjacencyValid = true;
+	}
+
+	std::vector<T> vertices;	/// id -> vertex
+	nonstd::unordered_map<T, int, VertexHash> vertexIndex;	/// vertex -> id
+	std::vector<std::vector<generalContainer::node>> edgeLists;	/// edges as added
+	generalContainer::csrGraph adjacency;	/// edgeLists sorted shortest first
+	bool adjacencyValid;	/// false once the graph changes after adjacency was built
+	std::vector<bool> visited;	/// vertex id -> visited by the last dfs
+	std::vector<int> pairOf;	/// adjacency edge -> id of its (min, max) vertex pair
+	int pairCount = 0;	/// number of vertex pairs with an edge
+	std::vector<bool> discovered;	/// pair id -> followed by the last dfs
+	std::vector<Edge<T>> discoveryEdges;	/// edges followed by the last dfs, in order
+	int dfsDistance;
+};
+}
+#endif //GRAPHDFS_H
@@ -0,0 +1,17 @@
+# Compares nonstd::unordered_map, nonstd::swiss_map and std::unordered_map
+# on int, QString and std::string keys; see main.cpp for the options
+
+TEMPLATE = app
+TARGET = hashbench
+CONFIG += console c++17
+CONFIG -= app_bundle
+QT = core
+
+INCLUDEPATH += $$PWD/../include $$PWD/../benchmarks
+
+SOURCES += \
+    $$PWD/../benchmarks/allocations.cpp \
+    main.cpp
+
+HEADERS += \
+    $$PWD/../benchmarks/allocations.h
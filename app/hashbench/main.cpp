@@ -0,0 +1,330 @@
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <QCoreApplication>
+#include <QHash>
+#include <QString>
+#include <QTextStream>
+#include "allocations.h"
+#include "unordered_map.h"
+
+namespace {
+	struct Options {
+		QList<int> sizes{1000, 100000, 1000000, 10000000};
+		int stringLimit = 1000000;	/// string keys skip larger sizes, they need GBs
+		unsigned seed = 1;
+		bool csv = false;
+	};
+
+	struct QStringHash {
+		size_t operator()(const QString &key) const { return qHash(key); }
+	};
+
+	struct Result {
+		QString container;
+		double insertNs = 0;	/// per element, building from empty without reserve
+		double hitNs = 0;
+		double missNs = 0;
+		double eraseNs = 0;
+		double iterateNs = 0;
+		double bytes = 0;		/// live heap per element after building, keys included when malloc is counted
+		double loadFactor = 0;
+		std::vector<size_t> probes;	/// entries found after 1, 2, ... probes
+	};
+
+	QTextStream out(stdout);
+	QTextStream err(stderr);
+
+	// keeps the timed loops from being optimized away
+	volatile size_t sink;
+
+	// bijective on 32 bits, so distinct inputs give distinct keys
+	quint32 Mix(quint32 x)
+	{
+		x ^= x >> 16;
+		x *= 0x7feb352du;
+		x ^= x >> 15;
+		x *= 0x846ca68bu;
+		x ^= x >> 16;
+		return x;
+	}
+
+	template<typename Key> Key MakeKey(quint32 i);
+
+	template<> int MakeKey<int>(quint32 i)
+	{ return (int) Mix(i); }
+
+	template<> std::string MakeKey<std::string>(quint32 i)
+	{ return "stadium-" + std::to_string(Mix(i)); }
+
+	template<> QString MakeKey<QString>(quint32 i)
+	{ return "stadium-" + QString::number(Mix(i)); }
+
+	// a copy with its own storage, so the map's bytes include the key's.
+	// Copying a QString only shares it, and int has nothing to copy
+	template<typename Key> Key Detach(const Key &key)
+	{ return key; }
+
+	template<> QString Detach<QString>(const QString &key)
+	{ return QString(key.constData(), key.size()); }
+
+	double Elapsed(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// std::unordered_map chains: the k-th entry of a bucket takes k probes
+	template<typename Key, typename Hash>
+	std::vector<size_t> ProbeLengths(const std::unordered_map<Key, int, Hash> &map)
+	{
+		std::vector<size_t> lengths;
+		for (size_t i = 0; i < map.bucket_count(); i++) {
+			size_t size = map.bucket_size(i);
+			if (size > lengths.size())
+				lengths.resize(size);
+			for (size_t k = 0; k < size; k++)
+				lengths[k]++;
+		}
+		return lengths;
+	}
+
+	template<typename Map>
+	auto ProbeLengths(const Map &map) -> decltype(map.probe_lengths())
+	{ return map.probe_lengths(); }
+
+	/*!
+	 * @brief Times every operation on one container. Small sizes repeat each
+	 * operation so every measurement covers about a million elements
+	 * @param hits; keys inserted, in insertion order
+	 * @param order; the same keys shuffled, for lookups and erasure
+	 * @param misses; keys never inserted
+	 */
+	template<typename Map, typename Key>
+	Result Run(const QString &container, const std::vector<Key> &hits,
+			   const std::vector<Key> &order, const std::vector<Key> &misses)
+	{
+		Result result;
+		result.container = container;
+		const size_t count = hits.size();
+		const int rounds = std::max<int>(1, 1000000 / count);
+		const double ops = (double) count * rounds;
+
+		Map map;
+		Allocations::Reset();
+		for (size_t i = 0; i < count; i++)
+			map.insert({Detach(hits[i]), (int) i});
+		result.bytes = (double) Allocations::Read().live / count;
+		result.loadFactor = (double) map.size() / map.bucket_count();
+		result.probes = ProbeLengths(map);
+
+		for (int round = 0; round < rounds; round++) {
+			Map fresh;
+			auto start = std::chrono::steady_clock::now();
+			for (size_t i = 0; i < count; i++)
+				fresh.insert({hits[i], (int) i});
+			result.insertNs += Elapsed(start);
+		}
+		result.insertNs /= ops;
+
+		size_t found = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int round = 0; round < rounds; round++)
+			for (const Key &key : order)
+				found += map.find(key) != map.end();
+		result.hitNs = Elapsed(start) / ops;
+
+		start = std::chrono::steady_clock::now();
+		for (int round = 0; round < rounds; round++)
+			for (const Key &key : misses)
+				found += map.find(key) != map.end();
+		result.missNs = Elapsed(start) / ops;
+
+		size_t total = 0;
+		start = std::chrono::steady_clock::now();
+		for (int round = 0; round < rounds; round++)
+			for (const auto &entry : map)
+				total += entry.second;
+		result.iterateNs = Elapsed(start) / ops;
+
+		for (int round = 0; round < rounds; round++) {
+			Map copy = map;
+			start = std::chrono::steady_clock::now();
+			for (const Key &key : order)
+				found += copy.erase(key);
+			result.eraseNs += Elapsed(start);
+		}
+		result.eraseNs /= ops;
+
+		sink = found + total;
+		return result;
+	}
+
+	// share of entries found after 1, 2, ... probes; the tail past 8 is summed
+	QString Distribution(const std::vector<size_t> &probes, const QString &separator)
+	{
+		size_t entries = 0;
+		for (size_t count : probes)
+			entries += count;
+
+		QStringList shares;
+		size_t tail = 0;
+		for (size_t i = 0; i < probes.size(); i++) {
+			if (i < 8)
+				shares.append(QString("%1:%2%").arg(i + 1).arg(100.0 * probes[i] / entries, 0, 'f', 1));
+			else
+				tail += probes[i];
+		}
+		if (tail)
+			shares.append(QString(">8:%1%").arg(100.0 * tail / entries, 0, 'f', 1));
+		return shares.join(separator);
+	}
+
+	double MeanProbes(const std::vector<size_t> &probes)
+	{
+		double entries = 0, sum = 0;
+		for (size_t i = 0; i < probes.size(); i++) {
+			entries += probes[i];
+			sum += (double) probes[i] * (i + 1);
+		}
+		return entries ? sum / entries : 0;
+	}
+
+	// one line of the text table: two left aligned columns, the rest right aligned
+	QString Row(const QStringList &columns)
+	{
+		const int widths[] = {12, 10, 10, 9, 9, 9, 9, 9, 10, 7, 7, 6};
+		QString line;
+		for (int i = 0; i < columns.size(); i++)
+			line += i < 2 ? columns[i].leftJustified(widths[i])
+						  : columns[i].rightJustified(widths[i]);
+		return line + "\n";
+	}
+
+	void Print(const Options &options, const QString &keys, int size, const Result &result)
+	{
+		if (options.csv) {
+			out << keys << ',' << result.container << ',' << size << ',' << result.insertNs << ','
+				<< result.hitNs << ',' << result.missNs << ',' << result.eraseNs << ','
+				<< result.iterateNs << ',' << result.bytes << ',' << result.loadFactor << ','
+				<< MeanProbes(result.probes) << ',' << result.probes.size() << ','
+				<< Distribution(result.probes, " ") << '\n';
+		} else {
+			out << Row({keys, result.container, QString::number(size),
+						QString::number(result.insertNs, 'f', 1),
+						QString::number(result.hitNs, 'f', 1),
+						QString::number(result.missNs, 'f', 1),
+						QString::number(result.eraseNs, 'f', 1),
+						QString::number(result.iterateNs, 'f', 1),
+						QString::number(result.bytes, 'f', 1),
+						QString::number(result.loadFactor, 'f', 2),
+						QString::number(MeanProbes(result.probes), 'f', 2),
+						QString::number(result.probes.size())});
+			out << "    probes " << Distribution(result.probes, "  ") << "\n";
+		}
+		out.flush();
+	}
+
+	template<typename Key>
+	void RunKeys(const Options &options, const QString &keys)
+	{
+		typedef typename std::conditional<std::is_same<Key, QString>::value,
+				QStringHash, std::hash<Key>>::type Hash;
+
+		for (int size : options.sizes) {
+			if (!std::is_same<Key, int>::value && size > options.stringLimit)
+				continue;
+
+			// even inputs are inserted and odd ones are misses
+			std::vector<Key> hits, misses;
+			hits.reserve(size);
+			misses.reserve(size);
+			for (quint32 i = 0; i < (quint32) size; i++) {
+				hits.push_back(MakeKey<Key>(2 * i));
+				misses.push_back(MakeKey<Key>(2 * i + 1));
+			}
+			std::vector<Key> order = hits;
+			std::shuffle(order.begin(), order.end(), std::mt19937(options.seed));
+
+			Print(options, keys, size, Run<nonstd::unordered_map<Key, int, Hash>>(
+					  "nonstd", hits, order, misses));
+			Print(options, keys, size, Run<nonstd::swiss_map<Key, int, Hash>>(
+					  "swiss", hits, order, misses));
+			Print(options, keys, size, Run<std::unordered_map<Key, int, Hash>>(
+					  "std", hits, order, misses));
+		}
+	}
+
+	bool ParseOptions(QStringList args, Options &options)
+	{
+		while (!args.isEmpty()) {
+			QString option = args.takeFirst();
+			if (option == "--csv") {
+				options.csv = true;
+				continue;
+			}
+			if (args.isEmpty())
+				return false;
+
+			QString value = args.takeFirst();
+			bool ok = true;
+			if (option == "--sizes") {
+				options.sizes.clear();
+				for (const QString &size : value.split(',', QString::SkipEmptyParts)) {
+					options.sizes.append(size.toInt(&ok));
+					if (!ok || options.sizes.back() < 1)
+						return false;
+				}
+			} else if (option == "--string-limit") {
+				options.stringLimit = value.toInt(&ok);
+			} else if (option == "--seed") {
+				options.seed = value.toUInt(&ok);
+			} else {
+				return false;
+			}
+			if (!ok)
+				return false;
+		}
+		return true;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	QCoreApplication app(argc, argv);
+	QStringList args = app.arguments();
+	args.removeFirst();
+
+	Options options;
+	if (!ParseOptions(args, options)) {
+		err << "usage: hashbench [--sizes 1000,100000,1000000,10000000]\n"
+			   "                 [--string-limit 1000000] [--seed 1] [--csv]\n"
+			   "Compares nonstd::unordered_map, nonstd::swiss_map and\n"
+			   "std::unordered_map on int, QString and std::string keys. Times\n"
+			   "are nanoseconds per element; bytes are live heap per element.\n"
+			<< (Allocations::CountsMalloc()
+				? "Every key is copied into the map with its own storage, which\n"
+				  "bytes includes for QString and std::string alike.\n"
+				: "Only operator new is counted here, so bytes include the storage\n"
+				  "of std::string keys but not of QString keys, which Qt allocates\n"
+				  "with malloc.\n")
+			<< "probes is the number of buckets a successful find inspects: the\n"
+			   "distance from the home bucket plus one, the number of 16 tag\n"
+			   "groups for swiss_map, or the position in the chain for\n"
+			   "std::unordered_map.\n";
+		return 2;
+	}
+
+	if (options.csv)
+		out << "keys,container,size,insert_ns,hit_ns,miss_ns,erase_ns,iterate_ns,"
+			   "bytes_per_element,load_factor,mean_probes,max_probes,probe_distribution\n";
+	else
+		out << Row({"keys", "container", "size", "insert", "hit", "miss", "erase",
+					"iterate", "bytes", "load", "probes", "max"});
+
+	RunKeys<int>(options, "int");
+	RunKeys<QString>(options, "QString");
+	RunKeys<std::string>(options, "std::string");
+	return 0;
+}
@@ -0,0 +1,229 @@
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace nonstd {
+    // Ordered map kept as one sorted vector of pairs. Lookups are binary
+    // searches and iteration is a walk over contiguous memory; inserting or
+    // erasing shifts the entries after the position, so it suits indexes
+    // that are read far more often than they change. Iterators and
+    // references are invalidated by every insert and erase. Keys must not
+    // be modified through an iterator.
+    template<typename Key, typename Mapped, typename Compare = std::less<Key>,
+    typename Allocator = std::allocator<std::pair<Key, Mapped>>>
+    class flat_map {
+    public:
+        typedef Key key_type;
+        typedef Mapped mapped_type;
+        typedef std::pair<Key, Mapped> value_type;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+        typedef Compare key_compare;
+        typedef Allocator allocator_type;
+        typedef value_type& reference;
+        typedef const value_type& const_reference;
+
+    private:
+        typedef std::vector<value_type, Allocator> Values;
+
+    public:
+        typedef typename Values::iterator iterator;
+        typedef typename Values::const_iterator const_iterator;
+        typedef typename Values::const_reverse_iterator const_reverse_iterator;
+
+        flat_map() = default;
+
+        explicit flat_map(const Compare& compare, const allocator_type& alloc = allocator_type())
+        : m_values{alloc}, m_compare{compare}
+        {}
+
+        // sorts once; of entries with equal keys the first one is kept
+        template <typename InputIt>
+        flat_map(InputIt first, InputIt last, const Compare& compare = Compare())
+        : m_values(first, last), m_compare{compare}
+        { sortValues(); }
+
+        flat_map(std::initializer_list<value_type> init, const Compare& compare = Compare())
+        : flat_map(init.begin(), init.end(), compare)
+        {}
+
+        iterator begin() { return m_values.begin(); }
+        iterator end() { return m_values.end(); }
+        const_iterator begin() const { return m_values.begin(); }
+        const_iterator end() const { return m_values.end(); }
+        const_iterator cbegin() const { return m_values.cbegin(); }
+        const_iterator cend() const { return m_values.cend(); }
+        const_reverse_iterator rbegin() const { return m_values.rbegin(); }
+        const_reverse_iterator rend() const { return m_values.rend(); }
+
+        bool empty() const { return m_values.empty(); }
+        size_t size() const { return m_values.size(); }
+        void clear() { m_values.clear(); }
+        void reserve(size_t capacity) { m_values.reserve(capacity); }
+        void shrink_to_fit() { m_values.shrink_to_fit(); }
+
+        // i-th entry in key order
+        const value_type& nth(size_t i) const { return m_values[i]; }
+
+        std::pair<iterator, bool> insert(const value_type& value)
+        { return emplace(value); }
+
+        std::pair<iterator, bool> insert(value_type&& value)
+        { return emplace(std::move(value)); }
+
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args)
+        {
+            value_type value(std::forward<Args>(args)...);
+            iterator position = lower_bound(value.first);
+            if (position != end() && !m_compare(value.first, position->first))
+                return {position, false};
+            return {m_values.insert(position, std::move(value)), true};
+        }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj)
+        {
+            iterator position = lower_bound(key);
+            if (position != end() && !m_compare(key, position->first)) {
+                position->second = std::forward<M>(obj);
+                return {position, false};
+            }
+            return {m_values.emplace(position, key, std::forward<M>(obj)), true};
+        }
+
+        // sorts once, so adding many entries costs O((n + m) log(n + m))
+        // instead of O(n) per entry; existing keys win over new ones
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            m_values.insert(m_values.end(), first, last);
+            sortValues();
+        }
+
+        iterator erase(const_iterator position)
+        { return m_values.erase(position); }
+
+        iterator erase(const_iterator first, const_iterator last)
+        { return m_values.erase(first, last); }
+
+        size_t erase(const key_type& key)
+        {
+            iterator found = find(key);
+            if (found == end())
+                return 0;
+            m_values.erase(found);
+            return 1;
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            iterator position = lower_bound(key);
+            if (position == end() || m_compare(key, position->first))
+                position = m_values.emplace(position, key, mapped_type());
+            return position->second;
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            iterator found = find(key);
+            if (found == end())
+                throw std::out_of_range("Invalid key");
+            return found->second;
+        }
+
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator found = find(key);
+            if (found == end())
+                throw std::out_of_range("Invalid key");
+            return found->second;
+        }
+
+        iterator find(const key_type& key)
+        {
+            iterator position = lower_bound(key);
+            return position != end() && !m_compare(key, position->first) ? position : end();
+        }
+
+        const_iterator find(const key_type& key) const
+        { return const_cast<flat_map*>(this)->find(key); }
+
+        size_t count(const key_type& key) const
+        { return find(key) != end() ? 1 : 0; }
+
+        bool contains(const key_type& key) const
+        { return find(key) != end(); }
+
+        iterator lower_bound(const key_type& key)
+        {
+            return std::lower_bound(m_values.begin(), m_values.end(), key,
+                                    [this](const value_type& value, const key_type& k) {
+                                        return m_compare(value.first, k);
+                                    });
+        }
+
+        const_iterator lower_bound(const key_type& key) const
+        { return const_cast<flat_map*>(this)->lower_bound(key); }
+
+        iterator upper_bound(const key_type& key)
+        {
+            return std::upper_bound(m_values.begin(), m_values.end(), key,
+                                    [this](const key_type& k, const value_type& value) {
+                                        return m_compare(k, value.first);
+                                    });
+        }
+
+        const_iterator upper_bound(const key_type& key) const
+        { return const_cast<flat_map*>(this)->upper_bound(key); }
+
+        std::pair<iterator, iterator> equal_range(const key_type& key)
+        {
+            iterator first = lower_bound(key);
+            iterator last = first != end() && !m_compare(key, first->first) ? first + 1 : first;
+            return {first, last};
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        {
+            auto range = const_cast<flat_map*>(this)->equal_range(key);
+            return {range.first, range.second};
+        }
+
+        key_compare key_comp() const { return m_compare; }
+
+        allocator_type get_allocator() const { return m_values.get_allocator(); }
+
+        bool operator==(const flat_map& rhs) const
+        { return m_values == rhs.m_values; }
+
+        bool operator!=(const flat_map& rhs) const
+        { return !operator==(rhs); }
+
+    private:
+        // stable, so the first of equal keys is the one kept
+        void sortValues()
+        {
+            std::stable_sort(m_values.begin(), m_values.end(),
+                             [this](const value_type& a, const value_type& b) {
+                                 return m_compare(a.first, b.first);
+                             });
+            auto last = std::unique(m_values.begin(), m_values.end(),
+                                    [this](const value_type& a, const value_type& b) {
+                                        return !m_compare(a.first, b.first);
+                                    });
+            m_values.erase(last, m_values.end());
+        }
+
+        Values m_values;
+        Compare m_compare;
+    };
+}
+
+#endif // FLAT_MAP_H
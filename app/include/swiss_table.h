@@ -0,0 +1,577 @@
+#ifndef SWISS_TABLE_H
+#define SWISS_TABLE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NONSTD_SWISS_SSE2 1
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace nonstd {
+
+    // Open addressing with the metadata split from the values, after
+    // Abseil's Swiss tables. Every slot has a one byte control tag: empty,
+    // deleted, or the low 7 bits of the entry's hash. Tags are kept in a
+    // dense array and probed a group of 16 at a time, so a find touches
+    // values only for tags that match, and a miss usually reads one 16
+    // byte group of tags and no values at all. Same interface as
+    // hash_table; pick it with unordered_map's Layout parameter.
+    template <typename Value, typename Key, typename GetKey, typename Hash, typename Equals, typename Allocator>
+    struct swiss_table {
+    private:
+        typedef int8_t Ctrl;
+        static constexpr Ctrl Empty = -128;
+        static constexpr Ctrl Deleted = -2;
+        static constexpr Ctrl Sentinel = -1; // after the last slot; ends iteration
+        static constexpr size_t GroupWidth = 16;
+
+        typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Value> SlotAllocator;
+        typedef std::allocator_traits<SlotAllocator> SlotTraits;
+        typedef std::vector<Ctrl, typename std::allocator_traits<Allocator>::template rebind_alloc<Ctrl>> Ctrls;
+
+        static unsigned lowestBit(uint32_t mask)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return index;
+#else
+            return __builtin_ctz(mask);
+#endif
+        }
+
+        // 16 control bytes; every match is a bit mask with bit i for byte i
+        struct Group {
+#ifdef NONSTD_SWISS_SSE2
+            explicit Group(const Ctrl* ctrl)
+            : tags{_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))}
+            {}
+
+            uint32_t match(Ctrl tag) const
+            { return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), tags)); }
+
+            // empty and deleted are the only tags with the sign bit set
+            uint32_t matchFree() const
+            { return _mm_movemask_epi8(tags); }
+
+            __m128i tags;
+#else
+            explicit Group(const Ctrl* ctrl)
+            { std::memcpy(tags, ctrl, GroupWidth); }
+
+            uint32_t match(Ctrl tag) const
+            {
+                uint32_t mask = 0;
+                for (size_t i = 0; i < GroupWidth; i++)
+                    mask |= uint32_t(tags[i] == tag) << i;
+                return mask;
+            }
+
+            uint32_t matchFree() const
+            {
+                uint32_t mask = 0;
+                for (size_t i = 0; i < GroupWidth; i++)
+                    mask |= uint32_t(tags[i] < 0) << i;
+                return mask;
+            }
+
+            Ctrl tags[GroupWidth];
+#endif
+            uint32_t matchEmpty() const { return match(Empty); }
+        };
+
+        // one control byte past a table without slots, so end() has
+        // somewhere to point
+        static Ctrl* emptyCtrl()
+        {
+            static Ctrl sentinel = Sentinel;
+            return &sentinel;
+        }
+
+        static const Ctrl* scan(const Ctrl* ctrl)
+        {
+            while (*ctrl < Sentinel) ctrl++;
+            return ctrl;
+        }
+
+    public:
+        struct const_iterator {
+            bool operator==(const const_iterator& rhs) const
+            { return ctrl == rhs.ctrl; }
+
+            bool operator!=(const const_iterator& rhs) const
+            { return ctrl != rhs.ctrl; }
+
+            auto operator++() -> const_iterator&
+            {
+                const Ctrl* next = scan(ctrl + 1);
+                slot += next - ctrl;
+                ctrl = next;
+                return *this;
+            }
+
+            auto operator++(int) -> const_iterator
+            {
+                const_iterator copy(*this);
+                operator++();
+                return copy;
+            }
+
+            auto operator*() const -> const Value&
+            { return *slot; }
+
+            auto operator->() const -> const Value*
+            { return slot; }
+
+            const Ctrl* ctrl;
+            const Value* slot;
+        };
+
+        struct iterator {
+            bool operator==(const iterator& rhs) const
+            { return ctrl == rhs.ctrl; }
+
+            bool operator!=(const iterator& rhs) const
+            { return ctrl != rhs.ctrl; }
+
+            auto operator++() -> iterator&
+            {
+                const Ctrl* next = scan(ctrl + 1);
+                slot += next - ctrl;
+                ctrl = const_cast<Ctrl*>(next);
+                return *this;
+            }
+
+            auto operator++(int) -> iterator
+            {
+                iterator copy(*this);
+                operator++();
+                return copy;
+            }
+
+            auto operator*() const -> Value& { return *slot; }
+            auto operator->() const -> Value* { return slot; }
+
+            operator const_iterator() const { return const_iterator{ctrl, slot}; }
+            Ctrl* ctrl;
+            Value* slot;
+        };
+
+        swiss_table(size_t bucketCount, GetKey const& getKey, Hash const& hash,
+                    Equals const& equal, Allocator const& alloc)
+        : m_ctrl{alloc}, m_slotAlloc{alloc}, m_getKey{getKey}, m_hash{hash}, m_equals{equal}
+        { if (bucketCount != 0) reserve(bucketCount); }
+
+        swiss_table(const swiss_table& rhs)
+        : m_ctrl{SlotTraits::select_on_container_copy_construction(rhs.m_slotAlloc)},
+          m_slotAlloc{SlotTraits::select_on_container_copy_construction(rhs.m_slotAlloc)},
+          m_maxFillLevel{rhs.m_maxFillLevel}, m_getKey{rhs.m_getKey}, m_hash{rhs.m_hash},
+          m_equals{rhs.m_equals}
+        { copyFrom(rhs); }
+
+        swiss_table(swiss_table&& rhs) noexcept
+        : m_ctrl{std::move(rhs.m_ctrl)}, m_slots{rhs.m_slots}, m_slotAlloc{rhs.m_slotAlloc},
+          m_filledCount{rhs.m_filledCount}, m_growthLeft{rhs.m_growthLeft},
+          m_maxFillLevel{rhs.m_maxFillLevel}, m_getKey{std::move(rhs.m_getKey)},
+          m_hash{std::move(rhs.m_hash)}, m_equals{std::move(rhs.m_equals)}
+        { rhs.forget(); }
+
+        ~swiss_table() { release(); }
+
+        // the allocator is replaced only if it propagates on copy assignment
+        swiss_table& operator=(const swiss_table& rhs)
+        {
+            if (this == &rhs)
+                return *this;
+            if constexpr (SlotTraits::propagate_on_container_copy_assignment::value) {
+                if (m_slotAlloc != rhs.m_slotAlloc) {
+                    release();
+                    forget();
+                    m_ctrl = Ctrls(rhs.m_ctrl.get_allocator());
+                }
+                m_slotAlloc = rhs.m_slotAlloc;
+            }
+            clear();
+            m_maxFillLevel = rhs.m_maxFillLevel;
+            m_getKey = rhs.m_getKey;
+            m_hash = rhs.m_hash;
+            m_equals = rhs.m_equals;
+            copyFrom(rhs);
+            return *this;
+        }
+
+        // steals rhs's storage when the allocator propagates or the two
+        // compare equal; otherwise entries move one by one into storage from
+        // this table's allocator. rhs is left empty either way
+        swiss_table& operator=(swiss_table&& rhs)
+        {
+            if (this == &rhs)
+                return *this;
+            m_maxFillLevel = rhs.m_maxFillLevel;
+            m_getKey = std::move(rhs.m_getKey);
+            m_hash = std::move(rhs.m_hash);
+            m_equals = std::move(rhs.m_equals);
+
+            if (SlotTraits::propagate_on_container_move_assignment::value || m_slotAlloc == rhs.m_slotAlloc) {
+                release();
+                if constexpr (SlotTraits::propagate_on_container_move_assignment::value)
+                    m_slotAlloc = std::move(rhs.m_slotAlloc);
+                m_ctrl = std::move(rhs.m_ctrl);
+                m_slots = rhs.m_slots;
+                m_filledCount = rhs.m_filledCount;
+                m_growthLeft = rhs.m_growthLeft;
+                rhs.m_slots = nullptr;
+            } else {
+                clear();
+                reserve(rhs.size());
+                for (size_t i = 0; i < rhs.bucketCount(); i++) {
+                    if (rhs.m_ctrl[i] >= 0)
+                        insert(std::move(rhs.m_slots[i]));
+                }
+                rhs.release();
+            }
+            rhs.forget();
+            return *this;
+        }
+
+        iterator begin()
+        {
+            if (m_filledCount == 0)
+                return end();
+            Ctrl* ctrl = const_cast<Ctrl*>(scan(m_ctrl.data()));
+            return iterator{ctrl, m_slots + (ctrl - m_ctrl.data())};
+        }
+
+        iterator end()
+        {
+            if (m_ctrl.empty())
+                return iterator{emptyCtrl(), nullptr};
+            return iterator{m_ctrl.data() + bucketCount(), m_slots + bucketCount()};
+        }
+
+        const_iterator begin() const
+        { return const_cast<swiss_table*>(this)->begin(); }
+
+        const_iterator end() const
+        { return const_cast<swiss_table*>(this)->end(); }
+
+        size_t empty() const { return m_filledCount == 0; }
+
+        size_t size() const { return m_filledCount; }
+
+        void clear()
+        {
+            for (size_t i = 0; i < bucketCount(); i++) {
+                if (m_ctrl[i] >= 0)
+                    SlotTraits::destroy(m_slotAlloc, m_slots + i);
+                m_ctrl[i] = Empty;
+            }
+            m_filledCount = 0;
+            m_growthLeft = growthCapacity(bucketCount());
+        }
+
+        std::pair<iterator, bool> insert(Value value)
+        {
+            size_t hash = mix(m_hash(m_getKey(value)));
+            iterator found = find(m_getKey(value), hash);
+            if (found != end())
+                return std::make_pair(found, false);
+
+            size_t index = freeSlot(hash);
+            // reusing a deleted slot costs no growth; a fresh empty one does
+            if (m_growthLeft == 0 && m_ctrl[index] == Empty) {
+                grow();
+                index = freeSlot(hash);
+            }
+            if (m_ctrl[index] == Empty)
+                m_growthLeft--;
+
+            SlotTraits::construct(m_slotAlloc, m_slots + index, std::move(value));
+            m_ctrl[index] = tag(hash);
+            m_filledCount++;
+            return std::make_pair(iterator{m_ctrl.data() + index, m_slots + index}, true);
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            size_t index = pos.ctrl - m_ctrl.data();
+            SlotTraits::destroy(m_slotAlloc, m_slots + index);
+            m_filledCount--;
+
+            // probes stop at a group with an empty tag, so a slot in such a
+            // group can go back to empty; otherwise it must stay a tombstone
+            // for the probes that run through it
+            if (Group(m_ctrl.data() + index / GroupWidth * GroupWidth).matchEmpty()) {
+                m_ctrl[index] = Empty;
+                m_growthLeft++;
+            } else {
+                m_ctrl[index] = Deleted;
+            }
+
+            Ctrl* next = const_cast<Ctrl*>(scan(m_ctrl.data() + index));
+            return iterator{next, m_slots + (next - m_ctrl.data())};
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+                first = erase(first);
+            return iterator{const_cast<Ctrl*>(first.ctrl), const_cast<Value*>(first.slot)};
+        }
+
+        // K is Key, or anything Hash and Equals accept alongside Key
+        template <typename K>
+        const_iterator find(const K& key) const
+        { return const_cast<swiss_table*>(this)->find(key); }
+
+        template <typename K>
+        iterator find(const K& key)
+        {
+            if (m_filledCount == 0)
+                return end();
+            return find(key, mix(m_hash(key)));
+        }
+
+        void reserve(size_t capacity)
+        {
+            if (capacity > m_filledCount + m_growthLeft)
+                rehash(capacity);
+        }
+
+        // fewest slots that hold max(count, size()) entries under the fill
+        // ceiling; may shrink, and always clears out tombstones
+        void rehash(size_t count)
+        {
+            count = std::max(count, m_filledCount);
+            size_t newSize = MinCapacity;
+            while ((double) count / (double) newSize > m_maxFillLevel)
+                newSize *= 2;
+            resize(newSize);
+        }
+
+        // an empty table gives its slots back entirely
+        void shrinkToFit()
+        {
+            if (m_filledCount != 0) {
+                rehash(0);
+                return;
+            }
+            release();
+            forget();
+        }
+
+        double maxFillLevel() const { return m_maxFillLevel; }
+
+        // clamped so every group keeps a free tag on average; a lower
+        // ceiling grows the table right away
+        void setMaxFillLevel(double level)
+        {
+            m_maxFillLevel = std::min(std::max(level, MinFillLevel), MaxFillLevel);
+            if (!m_ctrl.empty() && (double) m_filledCount / (double) bucketCount() > m_maxFillLevel)
+                rehash(0);
+            else
+                m_growthLeft = growthCapacity(bucketCount()) - std::min(growthCapacity(bucketCount()),
+                                                                        m_filledCount + tombstones());
+        }
+
+        Allocator getAllocator() const { return Allocator(m_slotAlloc); }
+
+        // slots; the control array has one more byte for the sentinel
+        size_t bucketCount() const
+        { return m_ctrl.empty() ? 0 : m_ctrl.size() - 1; }
+
+        // entries by the number of groups probed before theirs; a find that
+        // hits an entry at distance d loads d + 1 groups of tags
+        std::vector<size_t> probeLengths() const
+        {
+            std::vector<size_t> lengths;
+            for (size_t i = 0; i < bucketCount(); i++) {
+                if (m_ctrl[i] < 0)
+                    continue;
+                size_t hash = mix(m_hash(m_getKey(m_slots[i])));
+                size_t group = home(hash);
+                size_t distance = 0;
+                while (group != i / GroupWidth)
+                    group = (group + ++distance) & groupMask();
+                if (distance >= lengths.size())
+                    lengths.resize(distance + 1);
+                lengths[distance]++;
+            }
+            return lengths;
+        }
+
+        // same entries; the order can differ with capacity and history
+        bool operator==(const swiss_table& rhs) const
+        {
+            if (size() != rhs.size())
+                return false;
+
+            for (const Value& value : *this) {
+                auto found = rhs.find(m_getKey(value));
+                if (found == rhs.end() || !(*found == value))
+                    return false;
+            }
+            return true;
+        }
+
+        bool operator!=(const swiss_table& rhs) const
+        { return !operator==(rhs); }
+
+    private:
+        static constexpr size_t MinCapacity = GroupWidth;
+        static constexpr double DefaultFillLevel = 0.875;
+        static constexpr double MinFillLevel = 0.1;
+        static constexpr double MaxFillLevel = 0.9375;
+
+        // multiplies and folds so the tag and the home group come from
+        // different, well mixed bits even for identity hashes such as ints
+        static size_t mix(size_t hash)
+        {
+            uint64_t mixed = (uint64_t) hash * 0x9e3779b97f4a7c15ull;
+            return (size_t) (mixed ^ (mixed >> 32));
+        }
+
+        static Ctrl tag(size_t hash) { return (Ctrl) (hash & 0x7f); }
+
+        size_t groupMask() const { return bucketCount() / GroupWidth - 1; }
+
+        size_t home(size_t hash) const { return (hash >> 7) & groupMask(); }
+
+        size_t growthCapacity(size_t slotCount) const
+        { return (size_t) ((double) slotCount * m_maxFillLevel); }
+
+        size_t tombstones() const
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < bucketCount(); i++)
+                count += m_ctrl[i] == Deleted;
+            return count;
+        }
+
+        // groups are probed in triangular steps, which visits every group
+        // of a power of two table once
+        template <typename K>
+        iterator find(const K& key, size_t hash)
+        {
+            if (m_ctrl.empty())
+                return end();
+
+            size_t group = home(hash);
+            for (size_t step = 1; ; step++) {
+                size_t first = group * GroupWidth;
+                Group tags(m_ctrl.data() + first);
+                for (uint32_t mask = tags.match(tag(hash)); mask; mask &= mask - 1) {
+                    size_t index = first + lowestBit(mask);
+                    if (m_equals(m_getKey(m_slots[index]), key))
+                        return iterator{m_ctrl.data() + index, m_slots + index};
+                }
+                if (tags.matchEmpty() || step > groupMask())
+                    return end();
+                group = (group + step) & groupMask();
+            }
+        }
+
+        // first empty or deleted slot on the probe sequence of hash
+        size_t freeSlot(size_t hash)
+        {
+            if (m_ctrl.empty())
+                resize(MinCapacity);
+
+            size_t group = home(hash);
+            for (size_t step = 1; ; step++) {
+                size_t first = group * GroupWidth;
+                if (uint32_t mask = Group(m_ctrl.data() + first).matchFree())
+                    return first + lowestBit(mask);
+                group = (group + step) & groupMask();
+            }
+        }
+
+        // out of growth: tombstones alone are cleared in place, otherwise
+        // the table doubles
+        void grow()
+        {
+            if (m_filledCount < growthCapacity(bucketCount()) / 2)
+                resize(bucketCount());
+            else
+                resize(bucketCount() * 2);
+        }
+
+        // moves every entry into newSize slots
+        void resize(size_t newSize)
+        {
+            Ctrls oldCtrl{m_ctrl.get_allocator()};
+            std::swap(m_ctrl, oldCtrl);
+            Value* oldSlots = m_slots;
+            size_t oldSize = oldCtrl.empty() ? 0 : oldCtrl.size() - 1;
+
+            m_ctrl.assign(newSize + 1, Empty);
+            m_ctrl[newSize] = Sentinel;
+            m_slots = SlotTraits::allocate(m_slotAlloc, newSize);
+            m_growthLeft = growthCapacity(newSize) - m_filledCount;
+
+            for (size_t i = 0; i < oldSize; i++) {
+                if (oldCtrl[i] < 0)
+                    continue;
+                size_t hash = mix(m_hash(m_getKey(oldSlots[i])));
+                size_t index = freeSlot(hash);
+                SlotTraits::construct(m_slotAlloc, m_slots + index, std::move(oldSlots[i]));
+                SlotTraits::destroy(m_slotAlloc, oldSlots + i);
+                m_ctrl[index] = tag(hash);
+            }
+            if (oldSlots)
+                SlotTraits::deallocate(m_slotAlloc, oldSlots, oldSize);
+        }
+
+        void copyFrom(const swiss_table& rhs)
+        {
+            reserve(rhs.size());
+            for (const Value& value : rhs)
+                insert(value);
+        }
+
+        // destroys the entries and frees the storage; leaves the members
+        // for the caller to reset
+        void release()
+        {
+            if (!m_slots)
+                return;
+            for (size_t i = 0; i < bucketCount(); i++) {
+                if (m_ctrl[i] >= 0)
+                    SlotTraits::destroy(m_slotAlloc, m_slots + i);
+            }
+            SlotTraits::deallocate(m_slotAlloc, m_slots, bucketCount());
+            m_slots = nullptr;
+        }
+
+        // back to a table without storage, keeping the allocators
+        void forget()
+        {
+            m_ctrl = Ctrls(m_ctrl.get_allocator());
+            m_slots = nullptr;
+            m_filledCount = 0;
+            m_growthLeft = 0;
+        }
+
+        Ctrls m_ctrl;
+        Value* m_slots = nullptr;
+        SlotAllocator m_slotAlloc;
+        size_t m_filledCount = 0;
+        size_t m_growthLeft = 0;   // empty slots that may still be filled
+        double m_maxFillLevel = DefaultFillLevel;
+
+        GetKey m_getKey;
+        Hash m_hash;
+        Equals m_equals;
+    };
+}
+#endif // SWISS_TABLE_H
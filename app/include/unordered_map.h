@@ -1,353 +1,642 @@
-#ifndef UNORDERED_MAP_H
-#define UNORDERED_MAP_H
-
-#include <type_traits>
-#include <functional>
-#include "hash_table.h"
-
-namespace nonstd {
-    template<typename Key, typename Mapped, typename Hash = std::hash<Key>,
-    typename Equals = std::equal_to<Key>, typename Allocator = std::allocator<Key>>
-    class unordered_map {
-    public:
-        typedef Key key_type;
-        typedef Mapped mapped_type;
-        typedef std::pair<key_type const, mapped_type> value_type;
-        typedef size_t size_type;    
-        typedef ptrdiff_t difference_type;
-        typedef Hash hasher;
-        typedef Equals key_equal;
-        typedef Allocator allocator_type;
-        typedef value_type& reference;
-        typedef const value_type& const_reference;
-        typedef value_type* pointer;
-        typedef const value_type* const_pointer;
-    private:
-        typedef std::pair<key_type, mapped_type> TableValue;
-
-        struct GetKey {
-            const key_type& operator()(const TableValue& value) const
-            { return value.first; }
-        };
-
-        typedef hash_table<TableValue, key_type, GetKey, Hash, Equals,
-        typename std::allocator_traits<Allocator>::template rebind_alloc<TableValue>> Table;
-
-    public:
-        struct const_iterator {
-            friend class unordered_map;
-            typedef std::forward_iterator_tag iterator_category;
-            typedef typename unordered_map::value_type const value_type;
-            typedef ptrdiff_t difference_type;
-            typedef value_type* pointer;
-            typedef value_type& reference;
-
-            bool operator==(const const_iterator& rhs) const
-            { return inner == rhs.inner; }
-
-            bool operator!=(const const_iterator& rhs) const
-            { return inner != rhs.inner; }
-
-            auto operator++() -> const_iterator&
-            { ++inner; return *this; }
-            
-            auto operator++(int) -> const_iterator
-            { 
-                const_iterator copy(*this);
-                ++*this;
-                return copy;
-            }
-
-            auto operator*() const -> value_type&
-            { return *operator->(); }
-            auto operator->() const -> value_type*
-            { return (value_type*) (&*inner); }
-
-            typename Table::const_iterator inner;
-        };
-
-        struct iterator {
-            friend class unordered_map;
-            typedef std::forward_iterator_tag iterator_category;
-            typedef typename unordered_map::value_type value_type;
-            typedef ptrdiff_t difference_type;
-            typedef value_type* pointer;
-            typedef value_type& reference;
-
-            bool operator==(const iterator& rhs) const
-            { return inner == rhs.inner; }
-
-            bool operator!=(const iterator& rhs) const
-            { return inner != rhs.inner; }
-
-            auto operator++() -> iterator&
-            { ++inner; return *this; }
-
-            auto operator++(int) -> iterator
-            {
-                iterator copy(*this);
-                operator++();
-                return copy;
-            }
-
-            auto operator*() const -> value_type&
-            { return *operator->(); }
-
-            auto operator->() const -> value_type*
-            { return (value_type*) (&*inner); }
-
-            operator const_iterator() const
-            { return const_iterator{inner}; }
-
-            typename Table::iterator inner;
-        };
-
-        unordered_map() : unordered_map(0) {}
-
-        explicit unordered_map(size_t bucketCount, const hasher& hash = hasher(),
-                               const key_equal& equal = key_equal(),
-                               const allocator_type& alloc = allocator_type())
-                               : m_table{bucketCount, GetKey(), hash, equal, alloc}
-        {}
-
-        unordered_map(size_t bucketCount, const allocator_type& alloc)
-        : unordered_map(bucketCount, hasher(), key_equal(), alloc)
-        {}
-
-        unordered_map(size_t bucketCount, const hasher& hash, const allocator_type& alloc)
-        : unordered_map(bucketCount, hash, key_equal(), alloc)
-        {}
-
-        explicit unordered_map(const allocator_type& alloc)
-        : unordered_map(0, hasher(), key_equal(), alloc)
-        {}
-
-        template <typename InputIt>
-        unordered_map(InputIt first, InputIt last, size_t bucketCount = 0,
-                      const hasher& hash = hasher(),
-                      const key_equal& equal =key_equal(),
-                      const allocator_type& alloc = allocator_type())
-                      : unordered_map(bucketCount, hash, equal, alloc)
-        { insert(first, last); }
-
-        template <typename InputIt>
-        unordered_map(InputIt first, InputIt last, size_t bucketCount,
-                      const allocator_type& alloc)
-                      : unordered_map(first, last,  bucketCount, hasher(),
-                                      key_equal(), alloc)
-        {}
-
-        template <typename InputIt>
-        unordered_map(InputIt first, InputIt last, size_t bucketCount,
-                      const hasher& hash, const allocator_type& alloc)
-                      : unordered_map(first, last, bucketCount, hash, key_equal(), alloc)
-        {}
-
-        unordered_map(const unordered_map& other)
-        : unordered_map(other, other.m_table.getAllocator())
-        {}
-
-        unordered_map(const unordered_map& other, const allocator_type& alloc)
-        : unordered_map(alloc)
-        { operator=(other); }
-
-        unordered_map(unordered_map&& other) noexcept
-        : unordered_map(move(other), other.m_table.getAllocator())
-        {}
-        unordered_map(unordered_map&& other, const allocator_type& alloc) noexcept
-        : unordered_map(alloc)
-        { operator=(std::move(other)); }
-
-        unordered_map(std::initializer_list<value_type> init, size_t bucketCount = 0,
-                      const hasher& hash = hasher(), const key_equal& equal = key_equal(),
-                      const allocator_type& alloc = allocator_type())
-                      : unordered_map(bucketCount, hash, equal, alloc)
-        { operator=(init); }
-
-        unordered_map(std::initializer_list<value_type> init,
-                      size_t bucketCount, const allocator_type& alloc)
-                      : unordered_map(init, bucketCount, hasher(), key_equal(), alloc)
-        {}
-
-        unordered_map(std::initializer_list<value_type> init,
-                      size_t bucketCount, const hasher& hash,
-                      const allocator_type& alloc)
-                      : unordered_map(init, bucketCount, hash, key_equal(), alloc)
-        {}
-
-        auto operator=(const unordered_map& other) -> unordered_map&
-        {
-            m_table.clear();
-            m_table.reserve(other.size());
-            for (const auto& a : other)
-                m_table.insert(a);
-            return *this;
-        }
-
-        auto operator=(unordered_map&& other) noexcept -> unordered_map&
-        { m_table = move(other.m_table); return *this; }
-
-        auto operator=(std::initializer_list<value_type> init) -> unordered_map&
-        {
-            clear();
-            insert(init.begin(), init.end());
-            return *this;
-        }
-
-        iterator begin()
-        { return iterator{m_table.begin()}; }
-
-        iterator end()
-        { return iterator{m_table.end()}; }
-
-        const_iterator begin() const
-        { return const_iterator{m_table.begin()}; }
-
-        const_iterator end() const
-        { return const_iterator{m_table.end()}; }
-
-        const_iterator cbegin() const { return begin(); }
-
-        const_iterator cend() const { return end(); }
-
-        size_t empty() const { return m_table.empty(); }
-
-        size_t size() const { return m_table.size(); }
-
-        void clear() { m_table.clear(); }
-
-        std::pair<iterator, bool> insert(const value_type& value)
-        {
-            auto res = m_table.insert(TableValue(value));
-            return {iterator{res.first}, res.second};
-        }
-
-        template <typename T, typename = typename std::enable_if<std::is_constructible<TableValue, T&&>::value>::type>
-        std::pair<iterator, bool> insert(T&& value)
-        {
-            auto res = m_table.insert(TableValue(std::forward<T&&>(value)));
-            return {iterator{res.first}, res.second};
-        }
-
-        iterator insert(const_iterator hint, const value_type& value)
-        { return insert(hint, TableValue(value)); }
-
-        template <typename T, typename = typename std::enable_if<std::is_constructible<TableValue, T&&>::value>::type>
-        iterator insert(const_iterator /*hint*/, T&& value)
-        { return insert(std::forward<T&&>(value)).first; }
-
-        template <typename InputIt>
-        void insert(InputIt first, InputIt last)
-        {
-            m_table.reserve(m_table.size() + std::distance(first, last));
-            for (auto itr = first; itr != last; itr++)
-                m_table.insert(*itr);
-        }
-
-        void insert(std::initializer_list<value_type> init)
-        { insert(init.begin(), init.end()); }
-
-        template <typename... Args>
-        std::pair<iterator, bool> emplace(Args&&... args)
-        { return insert(TableValue(std::forward<Args>(args)...)); }
-
-        template <typename... Args>
-        iterator emplace_hint(const_iterator hint, Args&&... args)
-        { return insert(hint, TableValue(std::forward<Args>(args)...)); }
-
-
-        iterator erase(const_iterator pos)
-        { return iterator{m_table.erase(pos.inner)}; }
-
-        iterator erase(const_iterator first, const_iterator last)
-        { return iterator{m_table.erase(first.inner, last.inner)}; }
-
-        size_t erase(const key_type& key)
-        {
-            auto a = m_table.find(key);
-            if (a != m_table.end()) {
-                m_table.erase(a);
-                return 1;
-            }
-            return 0;
-        }
-
-        mapped_type& at(const key_type& key)
-        {
-            auto a = m_table.find(key);
-            if (a == m_table.end())
-                throw std::out_of_range("Invalid key");
-            return a->second;
-        }
-        const mapped_type& at(const key_type& key) const
-        {
-//            return const_cast<mapped_type>(at(key));
-            auto a = m_table.find(key);
-            if (a == m_table.end())
-                throw std::out_of_range("Invalid key");
-            return a->second;
-        }
-
-        mapped_type& operator[](const key_type& key)
-        {
-            auto i = m_table.find(key);
-            if (i != m_table.end())
-                return i->second;
-            return m_table.insert({key, mapped_type()}).first->second;
-        }
-        mapped_type& operator[](key_type&& key)
-        {
-            auto i = m_table.find(key);
-            if (i != m_table.end())
-                return i->second;
-            return m_table.insert({std::move(key), mapped_type()}).first->second;
-        }
-
-        size_t count(const key_type& key) const
-        { return (m_table.find(key) != m_table.end()) ? 1 : 0; }
-
-        const_iterator find(const key_type& key) const
-        { return const_iterator{m_table.find(key)}; }
-
-        iterator find(const key_type& key)
-        { return iterator{m_table.find(key)}; }
-
-        std::pair<iterator, iterator> equal_range(const key_type& key)
-        {
-            auto a = find(key);
-            if (a != end()) {
-                auto b = a;
-                ++b;
-                return {a, b};
-            } else {
-                return {a, a};
-            }
-        }
-
-        std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
-        {
-            auto a = find(key);
-            if (a != end()) {
-                auto b = a;
-                ++b;
-                return {a, b};
-            } else {
-                return {a, a};
-            }
-        }
-
-        void reserve(size_t capacity)
-        { m_table.reserve(capacity); }
-
-        bool operator==(const unordered_map& rhs) const
-        { return m_table == rhs.m_table; }
-
-        bool operator!=(const unordered_map& rhs) const
-        { return !operator==(rhs); }
-
-    private:
-        Table m_table;
-    };
-}
-
+#ifndef UNORDERED_MAP_H
+#define UNORDERED_MAP_H
+
+#include <type_traits>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include "hash_table.h"
+#include "swiss_table.h"
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+#ifdef __cpp_lib_memory_resource
+#define NONSTD_HAS_PMR 1
+#endif
+
+namespace nonstd {
+    // true when Hash and Equals both declare is_transparent, as in C++20
+    template <typename Hash, typename Equals, typename = void>
+    struct is_transparent : std::false_type {};
+
+    template <typename Hash, typename Equals>
+    struct is_transparent<Hash, Equals, std::void_t<typename Hash::is_transparent,
+    typename Equals::is_transparent>> : std::true_type {};
+
+    // Layout is the table underneath: hash_table keeps each entry beside its
+    // full hash (Robin Hood probing), swiss_table keeps one byte tags apart
+    // from the entries and probes them 16 at a time
+    template<typename Key, typename Mapped, typename Hash = std::hash<Key>,
+    typename Equals = std::equal_to<Key>, typename Allocator = std::allocator<Key>,
+    template <typename, typename, typename, typename, typename, typename> class Layout = hash_table>
+    class unordered_map {
+    public:
+        typedef Key key_type;
+        typedef Mapped mapped_type;
+        typedef std::pair<key_type const, mapped_type> value_type;
+        typedef size_t size_type;    
+        typedef ptrdiff_t difference_type;
+        typedef Hash hasher;
+        typedef Equals key_equal;
+        typedef Allocator allocator_type;
+        typedef value_type& reference;
+        typedef const value_type& const_reference;
+        typedef value_type* pointer;
+        typedef const value_type* const_pointer;
+    private:
+        typedef std::pair<key_type, mapped_type> TableValue;
+
+        struct GetKey {
+            const key_type& operator()(const TableValue& value) const
+            { return value.first; }
+        };
+
+        typedef Layout<TableValue, key_type, GetKey, Hash, Equals,
+        typename std::allocator_traits<Allocator>::template rebind_alloc<TableValue>> Table;
+
+    public:
+        struct const_iterator {
+            friend class unordered_map;
+            typedef std::forward_iterator_tag iterator_category;
+            typedef typename unordered_map::value_type const value_type;
+            typedef ptrdiff_t difference_type;
+            typedef value_type* pointer;
+            typedef value_type& reference;
+
+            bool operator==(const const_iterator& rhs) const
+            { return inner == rhs.inner; }
+
+            bool operator!=(const const_iterator& rhs) const
+            { return inner != rhs.inner; }
+
+            auto operator++() -> const_iterator&
+            { ++inner; return *this; }
+            
+            auto operator++(int) -> const_iterator
+            { 
+                const_iterator copy(*this);
+                ++*this;
+                return copy;
+            }
+
+            auto operator*() const -> value_type&
+            { return *operator->(); }
+            auto operator->() const -> value_type*
+            { return (value_type*) (&*inner); }
+
+            typename Table::const_iterator inner;
+        };
+
+        struct iterator {
+            friend class unordered_map;
+            typedef std::forward_iterator_tag iterator_category;
+            typedef typename unordered_map::value_type value_type;
+            typedef ptrdiff_t difference_type;
+            typedef value_type* pointer;
+            typedef value_type& reference;
+
+            bool operator==(const iterator& rhs) const
+            { return inner == rhs.inner; }
+
+            bool operator!=(const iterator& rhs) const
+            { return inner != rhs.inner; }
+
+            auto operator++() -> iterator&
+            { ++inner; return *this; }
+
+            auto operator++(int) -> iterator
+            {
+                iterator copy(*this);
+                operator++();
+                return copy;
+            }
+
+            auto operator*() const -> value_type&
+            { return *operator->(); }
+
+            auto operator->() const -> value_type*
+            { return (value_type*) (&*inner); }
+
+            operator const_iterator() const
+            { return const_iterator{inner}; }
+
+            typename Table::iterator inner;
+        };
+
+    private:
+        // lookups by K skip building a key_type; iterators still pick the
+        // erase(const_iterator) overload
+        template <typename K>
+        using Transparent = typename std::enable_if<is_transparent<Hash, Equals>::value
+        && !std::is_convertible<const K&, const_iterator>::value
+        && !std::is_convertible<const K&, iterator>::value>::type;
+
+    public:
+        // An extracted entry. Entries live inside the table's storage, so
+        // the handle owns the moved-out pair rather than the table's memory;
+        // moving a QString or a container this way never copies its data
+        class node_type {
+        public:
+            typedef Key key_type;
+            typedef Mapped mapped_type;
+            typedef Allocator allocator_type;
+
+            node_type() = default;
+
+            bool empty() const { return !m_value; }
+            explicit operator bool() const { return m_value.has_value(); }
+
+            key_type& key() const { return m_value->first; }
+            mapped_type& mapped() const { return m_value->second; }
+            allocator_type get_allocator() const { return m_alloc; }
+
+        private:
+            friend class unordered_map;
+            node_type(TableValue&& value, const allocator_type& alloc)
+            : m_value{std::move(value)}, m_alloc{alloc}
+            {}
+
+            mutable std::optional<TableValue> m_value;
+            allocator_type m_alloc;
+        };
+
+        struct insert_return_type {
+            iterator position;
+            bool inserted;
+            node_type node;
+        };
+
+        unordered_map() : unordered_map(0) {}
+
+        explicit unordered_map(size_t bucketCount, const hasher& hash = hasher(),
+                               const key_equal& equal = key_equal(),
+                               const allocator_type& alloc = allocator_type())
+                               : m_table{bucketCount, GetKey(), hash, equal, alloc}
+        {}
+
+        unordered_map(size_t bucketCount, const allocator_type& alloc)
+        : unordered_map(bucketCount, hasher(), key_equal(), alloc)
+        {}
+
+        unordered_map(size_t bucketCount, const hasher& hash, const allocator_type& alloc)
+        : unordered_map(bucketCount, hash, key_equal(), alloc)
+        {}
+
+        explicit unordered_map(const allocator_type& alloc)
+        : unordered_map(0, hasher(), key_equal(), alloc)
+        {}
+
+        template <typename InputIt>
+        unordered_map(InputIt first, InputIt last, size_t bucketCount = 0,
+                      const hasher& hash = hasher(),
+                      const key_equal& equal =key_equal(),
+                      const allocator_type& alloc = allocator_type())
+                      : unordered_map(bucketCount, hash, equal, alloc)
+        { insert(first, last); }
+
+        template <typename InputIt>
+        unordered_map(InputIt first, InputIt last, size_t bucketCount,
+                      const allocator_type& alloc)
+                      : unordered_map(first, last,  bucketCount, hasher(),
+                                      key_equal(), alloc)
+        {}
+
+        template <typename InputIt>
+        unordered_map(InputIt first, InputIt last, size_t bucketCount,
+                      const hasher& hash, const allocator_type& alloc)
+                      : unordered_map(first, last, bucketCount, hash, key_equal(), alloc)
+        {}
+
+        // like the standard containers, a copy asks the allocator which
+        // resource to use; a std::pmr map's copy lands on the default one
+        unordered_map(const unordered_map& other)
+        : unordered_map(other, std::allocator_traits<allocator_type>::
+                        select_on_container_copy_construction(other.get_allocator()))
+        {}
+
+        unordered_map(const unordered_map& other, const allocator_type& alloc)
+        : unordered_map(alloc)
+        { operator=(other); }
+
+        unordered_map(unordered_map&& other) noexcept
+        : m_table{std::move(other.m_table)}
+        {}
+
+        // with an allocator unequal to other's, entries move one by one
+        unordered_map(unordered_map&& other, const allocator_type& alloc)
+        : unordered_map(alloc)
+        { operator=(std::move(other)); }
+
+        unordered_map(std::initializer_list<value_type> init, size_t bucketCount = 0,
+                      const hasher& hash = hasher(), const key_equal& equal = key_equal(),
+                      const allocator_type& alloc = allocator_type())
+                      : unordered_map(bucketCount, hash, equal, alloc)
+        { operator=(init); }
+
+        unordered_map(std::initializer_list<value_type> init,
+                      size_t bucketCount, const allocator_type& alloc)
+                      : unordered_map(init, bucketCount, hasher(), key_equal(), alloc)
+        {}
+
+        unordered_map(std::initializer_list<value_type> init,
+                      size_t bucketCount, const hasher& hash,
+                      const allocator_type& alloc)
+                      : unordered_map(init, bucketCount, hash, key_equal(), alloc)
+        {}
+
+        // keeps this map's allocator unless it propagates on copy assignment
+        auto operator=(const unordered_map& other) -> unordered_map&
+        { m_table = other.m_table; return *this; }
+
+        // the table honours propagate_on_container_move_assignment; when the
+        // allocator stays and differs from other's, entries move one by one
+        auto operator=(unordered_map&& other)
+        noexcept(std::allocator_traits<allocator_type>::is_always_equal::value
+                 || std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value)
+        -> unordered_map&
+        { m_table = std::move(other.m_table); return *this; }
+
+        auto operator=(std::initializer_list<value_type> init) -> unordered_map&
+        {
+            clear();
+            insert(init.begin(), init.end());
+            return *this;
+        }
+
+        iterator begin()
+        { return iterator{m_table.begin()}; }
+
+        iterator end()
+        { return iterator{m_table.end()}; }
+
+        const_iterator begin() const
+        { return const_iterator{m_table.begin()}; }
+
+        const_iterator end() const
+        { return const_iterator{m_table.end()}; }
+
+        const_iterator cbegin() const { return begin(); }
+
+        const_iterator cend() const { return end(); }
+
+        size_t empty() const { return m_table.empty(); }
+
+        size_t size() const { return m_table.size(); }
+
+        void clear() { m_table.clear(); }
+
+        std::pair<iterator, bool> insert(const value_type& value)
+        {
+            auto res = m_table.insert(TableValue(value));
+            return {iterator{res.first}, res.second};
+        }
+
+        template <typename T, typename = typename std::enable_if<std::is_constructible<TableValue, T&&>::value>::type>
+        std::pair<iterator, bool> insert(T&& value)
+        {
+            auto res = m_table.insert(TableValue(std::forward<T&&>(value)));
+            return {iterator{res.first}, res.second};
+        }
+
+        iterator insert(const_iterator hint, const value_type& value)
+        { return insert(hint, TableValue(value)); }
+
+        template <typename T, typename = typename std::enable_if<std::is_constructible<TableValue, T&&>::value>::type>
+        iterator insert(const_iterator /*hint*/, T&& value)
+        { return insert(std::forward<T&&>(value)).first; }
+
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            m_table.reserve(m_table.size() + std::distance(first, last));
+            for (auto itr = first; itr != last; itr++)
+                m_table.insert(*itr);
+        }
+
+        void insert(std::initializer_list<value_type> init)
+        { insert(init.begin(), init.end()); }
+
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args)
+        { return insert(TableValue(std::forward<Args>(args)...)); }
+
+        template <typename... Args>
+        iterator emplace_hint(const_iterator hint, Args&&... args)
+        { return insert(hint, TableValue(std::forward<Args>(args)...)); }
+
+        // args build the mapped value only if key is absent
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            auto found = m_table.find(key);
+            if (found != m_table.end())
+                return {iterator{found}, false};
+            auto res = m_table.insert(TableValue(std::piecewise_construct, std::forward_as_tuple(key),
+                                                 std::forward_as_tuple(std::forward<Args>(args)...)));
+            return {iterator{res.first}, true};
+        }
+
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+        {
+            auto found = m_table.find(key);
+            if (found != m_table.end())
+                return {iterator{found}, false};
+            auto res = m_table.insert(TableValue(std::piecewise_construct,
+                                                 std::forward_as_tuple(std::move(key)),
+                                                 std::forward_as_tuple(std::forward<Args>(args)...)));
+            return {iterator{res.first}, true};
+        }
+
+        template <typename... Args>
+        iterator try_emplace(const_iterator /*hint*/, const key_type& key, Args&&... args)
+        { return try_emplace(key, std::forward<Args>(args)...).first; }
+
+        template <typename... Args>
+        iterator try_emplace(const_iterator /*hint*/, key_type&& key, Args&&... args)
+        { return try_emplace(std::move(key), std::forward<Args>(args)...).first; }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj)
+        {
+            auto found = m_table.find(key);
+            if (found != m_table.end()) {
+                found->second = std::forward<M>(obj);
+                return {iterator{found}, false};
+            }
+            auto res = m_table.insert(TableValue(key, std::forward<M>(obj)));
+            return {iterator{res.first}, true};
+        }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj)
+        {
+            auto found = m_table.find(key);
+            if (found != m_table.end()) {
+                found->second = std::forward<M>(obj);
+                return {iterator{found}, false};
+            }
+            auto res = m_table.insert(TableValue(std::move(key), std::forward<M>(obj)));
+            return {iterator{res.first}, true};
+        }
+
+        template <typename M>
+        iterator insert_or_assign(const_iterator /*hint*/, const key_type& key, M&& obj)
+        { return insert_or_assign(key, std::forward<M>(obj)).first; }
+
+        template <typename M>
+        iterator insert_or_assign(const_iterator /*hint*/, key_type&& key, M&& obj)
+        { return insert_or_assign(std::move(key), std::forward<M>(obj)).first; }
+
+        // a node whose key is already present comes back in the result
+        insert_return_type insert(node_type&& node)
+        {
+            if (node.empty())
+                return {end(), false, node_type()};
+            auto found = m_table.find(node.key());
+            if (found != m_table.end())
+                return {iterator{found}, false, std::move(node)};
+            auto res = m_table.insert(std::move(*node.m_value));
+            node.m_value.reset();
+            return {iterator{res.first}, true, node_type()};
+        }
+
+        iterator insert(const_iterator /*hint*/, node_type&& node)
+        { return insert(std::move(node)).position; }
+
+        node_type extract(const_iterator pos)
+        {
+            TableValue& value = const_cast<TableValue&>(*pos.inner);
+            node_type node(std::move(value), m_table.getAllocator());
+            m_table.erase(pos.inner);
+            return node;
+        }
+
+        node_type extract(const key_type& key)
+        {
+            auto found = find(key);
+            return found == end() ? node_type() : extract(found);
+        }
+
+        // moves over every entry of source whose key is not here yet; the
+        // rest stay in source
+        template <typename H, typename E, template <typename, typename, typename, typename, typename, typename> class L>
+        void merge(unordered_map<Key, Mapped, H, E, Allocator, L>& source)
+        {
+            for (auto i = source.m_table.begin(); i != source.m_table.end(); ) {
+                if (m_table.find(i->first) != m_table.end()) {
+                    ++i;
+                    continue;
+                }
+                m_table.insert(std::move(*i));
+                i = source.m_table.erase(i);
+            }
+        }
+
+        template <typename H, typename E, template <typename, typename, typename, typename, typename, typename> class L>
+        void merge(unordered_map<Key, Mapped, H, E, Allocator, L>&& source)
+        { merge(source); }
+
+
+        iterator erase(const_iterator pos)
+        { return iterator{m_table.erase(pos.inner)}; }
+
+        iterator erase(const_iterator first, const_iterator last)
+        { return iterator{m_table.erase(first.inner, last.inner)}; }
+
+        size_t erase(const key_type& key)
+        {
+            auto a = m_table.find(key);
+            if (a != m_table.end()) {
+                m_table.erase(a);
+                return 1;
+            }
+            return 0;
+        }
+
+        template <typename K, typename = Transparent<K>>
+        size_t erase(const K& key)
+        {
+            auto a = m_table.find(key);
+            if (a != m_table.end()) {
+                m_table.erase(a);
+                return 1;
+            }
+            return 0;
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            auto a = m_table.find(key);
+            if (a == m_table.end())
+                throw std::out_of_range("Invalid key");
+            return a->second;
+        }
+        const mapped_type& at(const key_type& key) const
+        {
+//            return const_cast<mapped_type>(at(key));
+            auto a = m_table.find(key);
+            if (a == m_table.end())
+                throw std::out_of_range("Invalid key");
+            return a->second;
+        }
+
+        template <typename K, typename = Transparent<K>>
+        mapped_type& at(const K& key)
+        {
+            auto a = m_table.find(key);
+            if (a == m_table.end())
+                throw std::out_of_range("Invalid key");
+            return a->second;
+        }
+
+        template <typename K, typename = Transparent<K>>
+        const mapped_type& at(const K& key) const
+        {
+            auto a = m_table.find(key);
+            if (a == m_table.end())
+                throw std::out_of_range("Invalid key");
+            return a->second;
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            auto i = m_table.find(key);
+            if (i != m_table.end())
+                return i->second;
+            return m_table.insert({key, mapped_type()}).first->second;
+        }
+        mapped_type& operator[](key_type&& key)
+        {
+            auto i = m_table.find(key);
+            if (i != m_table.end())
+                return i->second;
+            return m_table.insert({std::move(key), mapped_type()}).first->second;
+        }
+
+        size_t count(const key_type& key) const
+        { return (m_table.find(key) != m_table.end()) ? 1 : 0; }
+
+        const_iterator find(const key_type& key) const
+        { return const_iterator{m_table.find(key)}; }
+
+        iterator find(const key_type& key)
+        { return iterator{m_table.find(key)}; }
+
+        bool contains(const key_type& key) const
+        { return m_table.find(key) != m_table.end(); }
+
+        template <typename K, typename = Transparent<K>>
+        size_t count(const K& key) const
+        { return (m_table.find(key) != m_table.end()) ? 1 : 0; }
+
+        template <typename K, typename = Transparent<K>>
+        const_iterator find(const K& key) const
+        { return const_iterator{m_table.find(key)}; }
+
+        template <typename K, typename = Transparent<K>>
+        iterator find(const K& key)
+        { return iterator{m_table.find(key)}; }
+
+        template <typename K, typename = Transparent<K>>
+        bool contains(const K& key) const
+        { return m_table.find(key) != m_table.end(); }
+
+        std::pair<iterator, iterator> equal_range(const key_type& key)
+        {
+            auto a = find(key);
+            if (a != end()) {
+                auto b = a;
+                ++b;
+                return {a, b};
+            } else {
+                return {a, a};
+            }
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        {
+            auto a = find(key);
+            if (a != end()) {
+                auto b = a;
+                ++b;
+                return {a, b};
+            } else {
+                return {a, a};
+            }
+        }
+
+        void reserve(size_t capacity)
+        { m_table.reserve(capacity); }
+
+        allocator_type get_allocator() const
+        { return allocator_type(m_table.getAllocator()); }
+
+        size_t bucket_count() const
+        { return m_table.bucketCount(); }
+
+        float load_factor() const
+        { return bucket_count() == 0 ? 0.0f : (float) size() / (float) bucket_count(); }
+
+        float max_load_factor() const
+        { return (float) m_table.maxFillLevel(); }
+
+        // clamped to [0.1, 0.95]; lower ceilings mean shorter probes and
+        // more buckets. Grows the table if it is now over the ceiling
+        void max_load_factor(float ml)
+        { m_table.setMaxFillLevel(ml); }
+
+        // bucket count becomes the smallest power of two that is at least
+        // count and keeps size() under the ceiling, so rehash(0) shrinks
+        void rehash(size_t count)
+        { m_table.rehash(count); }
+
+        // returns the buckets left over from erasure; an empty map frees them all
+        void shrink_to_fit()
+        { m_table.shrinkToFit(); }
+
+        // entries by distance from their home bucket, for tuning and benchmarks
+        std::vector<size_t> probe_lengths() const
+        { return m_table.probeLengths(); }
+
+        bool operator==(const unordered_map& rhs) const
+        { return m_table == rhs.m_table; }
+
+        bool operator!=(const unordered_map& rhs) const
+        { return !operator==(rhs); }
+
+    private:
+        // merge reaches into maps with other hashes and layouts
+        template <typename, typename, typename, typename, typename,
+                  template <typename, typename, typename, typename, typename, typename> class>
+        friend class unordered_map;
+
+        Table m_table;
+    };
+
+    template<typename Key, typename Mapped, typename Hash = std::hash<Key>,
+    typename Equals = std::equal_to<Key>, typename Allocator = std::allocator<Key>>
+    using swiss_map = unordered_map<Key, Mapped, Hash, Equals, Allocator, swiss_table>;
+
+#ifdef NONSTD_HAS_PMR
+    // maps whose storage comes from a std::pmr::memory_resource, e.g. a
+    // monotonic_buffer_resource that frees a whole request's maps at once.
+    // Keys and values that allocate on their own, like QString, still use
+    // their own heap
+    namespace pmr {
+        template<typename Key, typename Mapped, typename Hash = std::hash<Key>,
+        typename Equals = std::equal_to<Key>>
+        using unordered_map = nonstd::unordered_map<Key, Mapped, Hash, Equals,
+        std::pmr::polymorphic_allocator<std::pair<const Key, Mapped>>>;
+
+        template<typename Key, typename Mapped, typename Hash = std::hash<Key>,
+        typename Equals = std::equal_to<Key>>
+        using swiss_map = nonstd::swiss_map<Key, Mapped, Hash, Equals,
+        std::pmr::polymorphic_allocator<std::pair<const Key, Mapped>>>;
+    }
+#endif
+}
+
 #endif // UNORDERED_MAP_H
\ No newline at end of file
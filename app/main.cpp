@@ -1,135 +1,408 @@
-#define Debug 0
-
-#if Debug == 0
-
-#include "mainwindow.h"
-#include <QApplication>
-
-#define print qDebug()
-
-int main(int argc, char *argv[])
-{
-	QApplication a(argc, argv);
-	MainWindow w;
-	w.show();
-	return a.exec();
-}
-
-#elif Debug == 1
-
-#include "mainwindow.h"
-#include <QApplication>
-#include "graph.h"
-
-#define print qDebug()
-
-int main(int argc, char *argv[])
-{
-	QApplication a(argc, argv);
-	MainWindow w;
-	Graph<QString> graph;
-	graph.generateGraph();
-	std::vector<QString> vect(graph.vertices());
-	std::vector<QString> dijkstra;
-	int costsD[graph.size()];
-	int parentD[graph.size()];
-
-    graph.DijkstraPathFinder("Arizona Cardinals",
-								 dijkstra, costsD, parentD);
-
-	for (auto &a : vect) {
-		std::vector<QString> path = graph.returnPath("Arizona Cardinals", a, parentD);
-		qDebug() << "Arizona Cardinals to " << a << "...\nPath: ";
-		qDebug() << path;
-		qDebug() << "\nTotal Distance: " << costsD[graph.findVertex(a)] << "\n\n";
-	}
-
-	w.show();
-	return a.exec();
-}
-
-#elif Debug == 2
-
-#include "unordered_map.h"
-#include <QDebug>
-#include <QString>
-
-#define print qDebug()
-
-void printToScreen(const nonstd::unordered_map<int, QString>& output)
-{
-	for (auto itr = output.begin(); itr != output.end(); itr++)
-		print << "{" << (*itr).first << ", " << (*itr).second << "}\n";
-	print << "size of the map: " << output.size() << "\n\n";
-}
-void test_unordered_map()
-{
-	std::pair<int, QString> pair = {9, "nine"};
-	nonstd::unordered_map<int, QString> test_map1 = {{1, "one"}, {20, "twenty"}, {5, "five"}, std::make_pair(8, "eight"), pair};
-
-	test_map1.insert({32, "thirty-two"});
-	test_map1[12] = "twelve";
-	test_map1[16] = "sixteen";
-
-	print << "{1}";
-	printToScreen(test_map1);
-
-
-	assert(!test_map1.empty());
-	assert(test_map1.find(2) == test_map1.end());
-	assert(test_map1.find(1)->second == "one");
-	assert(test_map1.size() == 8u);
-
-	test_map1.erase(test_map1.find(32));
-	assert(test_map1.find(32) == test_map1.end());
-	print << "{2}";
-	printToScreen(test_map1);
-	assert(test_map1.size() == 7u);
-
-	nonstd::unordered_map<int, QString> test_map2(test_map1.begin(),
-													  test_map1.end());
-	assert(test_map2 == test_map1);
-	test_map1.insert({100, "one hundred"});
-	print << "{3}";
-	print << "map one: \n";
-	printToScreen(test_map1);
-	print << "{4}";
-	print << "map two: \n";
-	printToScreen(test_map2);
-	assert(test_map2 != test_map1);
-
-	test_map1.clear();
-
-	assert(test_map1.size() == 0u);
-	print << "{5}";
-	printToScreen(test_map2);
-
-	assert(test_map2.insert({25, "tewenty five (spelled wrong)"}).second);
-	assert(!test_map2.insert({25, "not twenty five"}).second);
-	print << "{6}";
-	printToScreen(test_map2);
-
-	test_map2.at(25) = "twenty five";
-	print << "{7}";
-	printToScreen(test_map2);
-
-	nonstd::unordered_map<int, QString> test_map3;
-
-	test_map3 = test_map2;
-	assert(test_map3 == test_map2);
-
-	test_map2.erase(test_map2.begin(), test_map2.end());
-	assert(test_map2.size() == 0u);
-	print << "{8}";
-	printToScreen(test_map3);
-
-	test_map3.clear();
-	assert(test_map3.size() == 0u);
-}
-
-int main() {
-	test_unordered_map();
-	print << "tests passed!";
-	return 0;
-}
-#endif
+#define Debug 0
+
+#if Debug == 0
+
+#include "mainwindow.h"
+#include <QApplication>
+
+#define print qDebug()
+
+int main(int argc, char *argv[])
+{
+	QApplication a(argc, argv);
+	MainWindow w;
+	w.show();
+	return a.exec();
+}
+
+#elif Debug == 1
+
+#include "mainwindow.h"
+#include <QApplication>
+#include "graph.h"
+
+#define print qDebug()
+
+int main(int argc, char *argv[])
+{
+	QApplication a(argc, argv);
+	MainWindow w;
+	Graph<QString> graph;
+	graph.generateGraph();
+	std::vector<QString> vect(graph.vertices());
+	std::vector<QString> dijkstra;
+	int costsD[graph.size()];
+	int parentD[graph.size()];
+
+    graph.DijkstraPathFinder("Arizona Cardinals",
+								 dijkstra, costsD, parentD);
+
+	for (auto &a : vect) {
+		std::vector<QString> path = graph.returnPath("Arizona Cardinals", a, parentD);
+		qDebug() << "Arizona Cardinals to " << a << "...\nPath: ";
+		qDebug() << path;
+		qDebug() << "\nTotal Distance: " << costsD[graph.findVertex(a)] << "\n\n";
+	}
+
+	w.show();
+	return a.exec();
+}
+
+#elif Debug == 2
+
+#include "flat_map.h"
+#include "unordered_map.h"
+#include <QDebug>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+#define print qDebug()
+
+void printToScreen(const nonstd::unordered_map<int, QString>& output)
+{
+	for (auto itr = output.begin(); itr != output.end(); itr++)
+		print << "{" << (*itr).first << ", " << (*itr).second << "}\n";
+	print << "size of the map: " << output.size() << "\n\n";
+}
+void test_unordered_map()
+{
+	std::pair<int, QString> pair = {9, "nine"};
+	nonstd::unordered_map<int, QString> test_map1 = {{1, "one"}, {20, "twenty"}, {5, "five"}, std::make_pair(8, "eight"), pair};
+
+	test_map1.insert({32, "thirty-two"});
+	test_map1[12] = "twelve";
+	test_map1[16] = "sixteen";
+
+	print << "{1}";
+	printToScreen(test_map1);
+
+
+	assert(!test_map1.empty());
+	assert(test_map1.find(2) == test_map1.end());
+	assert(test_map1.find(1)->second == "one");
+	assert(test_map1.size() == 8u);
+
+	test_map1.erase(test_map1.find(32));
+	assert(test_map1.find(32) == test_map1.end());
+	print << "{2}";
+	printToScreen(test_map1);
+	assert(test_map1.size() == 7u);
+
+	nonstd::unordered_map<int, QString> test_map2(test_map1.begin(),
+													  test_map1.end());
+	assert(test_map2 == test_map1);
+	test_map1.insert({100, "one hundred"});
+	print << "{3}";
+	print << "map one: \n";
+	printToScreen(test_map1);
+	print << "{4}";
+	print << "map two: \n";
+	printToScreen(test_map2);
+	assert(test_map2 != test_map1);
+
+	test_map1.clear();
+
+	assert(test_map1.size() == 0u);
+	print << "{5}";
+	printToScreen(test_map2);
+
+	assert(test_map2.insert({25, "tewenty five (spelled wrong)"}).second);
+	assert(!test_map2.insert({25, "not twenty five"}).second);
+	print << "{6}";
+	printToScreen(test_map2);
+
+	test_map2.at(25) = "twenty five";
+	print << "{7}";
+	printToScreen(test_map2);
+
+	nonstd::unordered_map<int, QString> test_map3;
+
+	test_map3 = test_map2;
+	assert(test_map3 == test_map2);
+
+	test_map2.erase(test_map2.begin(), test_map2.end());
+	assert(test_map2.size() == 0u);
+	print << "{8}";
+	printToScreen(test_map3);
+
+	test_map3.clear();
+	assert(test_map3.size() == 0u);
+}
+
+void test_load_factor()
+{
+	nonstd::unordered_map<int, QString> map;
+	assert(map.bucket_count() == 0u && map.load_factor() == 0.0f);
+	assert(map.max_load_factor() > 0.69f && map.max_load_factor() < 0.71f);
+
+	for (int i = 0; i < 100; i++)
+		map[i] = QString::number(i);
+	assert(map.load_factor() <= map.max_load_factor());
+
+	// a lower ceiling grows the table at once
+	map.max_load_factor(0.25f);
+	assert(map.bucket_count() >= 400u);
+	assert(map.load_factor() <= 0.25f);
+	map.max_load_factor(5.0f);
+	assert(map.max_load_factor() < 1.0f);
+	map.max_load_factor(0.5f);
+
+	map.rehash(4096);
+	assert(map.bucket_count() == 4096u);
+	for (int i = 0; i < 100; i++)
+		assert(map.at(i) == QString::number(i));
+
+	for (int i = 0; i < 90; i++)
+		map.erase(i);
+	map.shrink_to_fit();
+	assert(map.bucket_count() == 32u);
+	assert(map.size() == 10u && map.at(95) == "95");
+
+	// the copy keeps the ceiling
+	nonstd::unordered_map<int, QString> copy;
+	copy = map;
+	assert(copy.max_load_factor() == map.max_load_factor() && copy == map);
+
+	map.clear();
+	map.shrink_to_fit();
+	assert(map.bucket_count() == 0u && map.find(1) == map.end());
+	map[1] = "one";
+	assert(map.size() == 1u && map.at(1) == "one");
+}
+
+struct ViewHash {
+	using is_transparent = void;
+	size_t operator()(QStringView key) const { return qHash(key); }
+};
+
+struct ViewEqual {
+	using is_transparent = void;
+	bool operator()(QStringView lhs, QStringView rhs) const { return lhs == rhs; }
+};
+
+void test_transparent_lookup()
+{
+	nonstd::unordered_map<QString, int, ViewHash, ViewEqual> map = {{"Dallas", 1}, {"Denver", 2}};
+	QString line = "Dallas,Denver,Detroit";
+
+	// views into line find the keys without building a QString
+	QStringView dallas = QStringView(line).mid(0, 6);
+	QStringView detroit = QStringView(line).mid(14);
+	assert(map.find(dallas)->second == 1);
+	assert(map.count(dallas) == 1u && map.contains(dallas));
+	assert(map.find(detroit) == map.end() && !map.contains(detroit));
+	assert(map.at(QStringView(line).mid(7, 6)) == 2);
+	assert(map.contains(QString("Denver")));
+
+	assert(map.erase(dallas) == 1u && map.erase(detroit) == 0u);
+	assert(map.size() == 1u && !map.contains(dallas));
+}
+
+void test_swiss_map()
+{
+	nonstd::swiss_map<int, QString> map;
+	for (int i = 0; i < 1000; i++)
+		map[i] = QString::number(i);
+	assert(map.size() == 1000u && map.load_factor() <= map.max_load_factor());
+
+	// erasing and refilling reuses deleted tags without growing
+	size_t buckets = map.bucket_count();
+	for (int round = 0; round < 10; round++) {
+		for (int i = 0; i < 1000; i += 2)
+			assert(map.erase(i) == 1u);
+		for (int i = 0; i < 1000; i += 2)
+			assert(map.insert({i, QString::number(i)}).second);
+	}
+	assert(map.bucket_count() == buckets);
+
+	size_t visited = 0;
+	for (const auto &entry : map) {
+		assert(entry.second == QString::number(entry.first));
+		visited++;
+	}
+	assert(visited == 1000u && map.find(1000) == map.end());
+
+	nonstd::swiss_map<int, QString> copy = map;
+	assert(copy == map);
+	map.erase(map.begin(), map.end());
+	assert(map.empty() && map.begin() == map.end() && copy.size() == 1000u);
+}
+
+void test_node_handles()
+{
+	nonstd::unordered_map<int, QString> map = {{1, "one"}, {2, "two"}};
+
+	// try_emplace leaves an existing entry and its arguments alone
+	QString name = "uno";
+	assert(!map.try_emplace(1, std::move(name)).second && name == "uno");
+	assert(map.try_emplace(3, 5, QChar('x')).second && map.at(3) == "xxxxx");
+
+	assert(!map.insert_or_assign(1, "uno").second && map.at(1) == "uno");
+	assert(map.insert_or_assign(4, "four").second && map.size() == 4u);
+
+	auto node = map.extract(2);
+	assert(node && node.key() == 2 && node.mapped() == "two" && !map.contains(2));
+	assert(map.extract(2).empty());
+
+	node.key() = 20;
+	auto result = map.insert(std::move(node));
+	assert(result.inserted && result.position->second == "two" && result.node.empty());
+
+	auto again = map.extract(map.find(20));
+	again.key() = 1;
+	result = map.insert(std::move(again));
+	assert(!result.inserted && result.position->second == "uno" && result.node.mapped() == "two");
+
+	// merge moves what is missing and leaves the clashes in the source
+	nonstd::swiss_map<int, QString> other = {{1, "clash"}, {5, "five"}, {6, "six"}};
+	map.merge(other);
+	assert(map.size() == 5u && map.at(5) == "five" && map.at(1) == "uno");
+	assert(other.size() == 1u && other.at(1) == "clash");
+}
+
+void test_flat_map()
+{
+	// unsorted input is sorted once and the first of a duplicate key wins
+	nonstd::flat_map<QString, int> map = {{"Lambeau Field", 1}, {"Arrowhead Stadium", 2},
+										  {"Soldier Field", 3}, {"Arrowhead Stadium", 4}};
+	assert(map.size() == 3u && map.nth(0).first == "Arrowhead Stadium" && map.at("Arrowhead Stadium") == 2);
+
+	assert(map.insert({"Ford Field", 5}).second && map.nth(1).first == "Ford Field");
+	assert(!map.insert({"Ford Field", 6}).second && map.at("Ford Field") == 5);
+	assert(!map.insert_or_assign("Ford Field", 6).second && map.at("Ford Field") == 6);
+	map["Heinz Field"] = 7;
+	assert(map.size() == 5u && map.count("Heinz Field") == 1u && !map.contains("Hard Rock Stadium"));
+
+	// range queries are binary searches over the sorted keys
+	assert(map.lower_bound("G")->first == "Heinz Field");
+	assert(map.upper_bound("Heinz Field")->first == "Lambeau Field");
+	auto range = map.equal_range("Soldier Field");
+	assert(range.second - range.first == 1 && range.second == map.end());
+
+	QStringList keys;
+	for (const auto &entry : map)
+		keys.append(entry.first);
+	QStringList sorted = keys;
+	sorted.sort();
+	assert(keys == sorted);
+
+	// bulk insert sorts once and keeps the existing entry of a clash
+	std::vector<std::pair<QString, int>> more = {{"Lucas Oil Stadium", 8}, {"Lambeau Field", 9}};
+	map.insert(more.begin(), more.end());
+	assert(map.size() == 6u && map.at("Lambeau Field") == 1 && map.nth(5).first == "Soldier Field");
+
+	assert(map.erase("Soldier Field") == 1u && map.erase("Soldier Field") == 0u);
+	map.erase(map.begin());
+	assert(map.size() == 4u && map.begin()->first == "Ford Field");
+
+	nonstd::flat_map<QString, int> copy = map;
+	assert(copy == map);
+	copy.clear();
+	assert(copy.empty() && copy != map);
+}
+
+#ifdef NONSTD_HAS_PMR
+// counts what passes through to upstream
+class CountingResource : public std::pmr::memory_resource {
+public:
+	size_t live = 0;
+	size_t allocations = 0;
+
+private:
+	void *do_allocate(size_t bytes, size_t alignment) override
+	{
+		live += bytes;
+		allocations++;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+	void do_deallocate(void *p, size_t bytes, size_t alignment) override
+	{
+		live -= bytes;
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{ return this == &other; }
+};
+
+template <typename Map>
+void test_allocator_propagation()
+{
+	CountingResource first, second;
+	// anything that falls back to the default resource throws
+	std::pmr::memory_resource *previous = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+
+	Map map(&first);
+	for (int i = 0; i < 1000; i++)
+		map[i] = i;
+	map.rehash(4096);
+	assert(map.get_allocator().resource() == &first && first.live > 0 && second.allocations == 0);
+
+	// copy assignment and the extended copy constructor keep the target's resource
+	Map copy(&second);
+	copy = map;
+	assert(copy == map && copy.get_allocator().resource() == &second && second.live > 0);
+	Map copy2(map, &second);
+	assert(copy2 == map && copy2.get_allocator().resource() == &second);
+
+	// moving between resources moves the entries and leaves the source empty
+	Map moved(&second);
+	moved = std::move(copy2);
+	assert(moved == map && moved.get_allocator().resource() == &second);
+	assert(copy2.empty() && copy2.begin() == copy2.end());
+
+	// moving within a resource steals the storage
+	size_t allocations = first.allocations;
+	Map stolen(std::move(map));
+	assert(stolen.size() == 1000u && map.empty() && first.allocations == allocations);
+	map[1] = 1;
+	assert(map.get_allocator().resource() == &first);
+
+	// the plain copy constructor asks for the default resource
+	std::pmr::set_default_resource(previous);
+	Map plain(stolen);
+	assert(plain.get_allocator().resource() == std::pmr::get_default_resource());
+
+	stolen.clear();
+	stolen.shrink_to_fit();
+	map.clear();
+	map.shrink_to_fit();
+	moved.clear();
+	moved.shrink_to_fit();
+	copy.clear();
+	copy.shrink_to_fit();
+	copy2.shrink_to_fit();
+	assert(first.live == 0 && second.live == 0);
+}
+
+void test_arena()
+{
+	// a whole request's maps freed by the arena; nothing reaches the heap
+	char buffer[1 << 16];
+	std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+	nonstd::pmr::unordered_map<int, int> ids(&arena);
+	nonstd::pmr::swiss_map<int, int> tags(&arena);
+	for (int i = 0; i < 500; i++) {
+		ids[i * 7] = i;
+		tags[i * 7] = i;
+	}
+	assert(ids.at(70) == 10 && tags.at(70) == 10);
+}
+#endif
+
+int main() {
+	test_unordered_map();
+	test_load_factor();
+	test_transparent_lookup();
+	test_swiss_map();
+	test_node_handles();
+	test_flat_map();
+#ifdef NONSTD_HAS_PMR
+	test_allocator_propagation<nonstd::pmr::unordered_map<int, int>>();
+	test_allocator_propagation<nonstd::pmr::swiss_map<int, int>>();
+	test_arena();
+#endif
+	print << "tests passed!";
+	return 0;
+}
+#endif
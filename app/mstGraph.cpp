@@ -1,122 +1,250 @@
-#include"mstGraph.h"
-
-mstGraph::mstGraph(){
-    int vertexNum = DBManager::instance()->GetNumTeams();
-    numVertex = vertexNum;
-    vertices.resize(vertexNum);
-	InitializeMatrix();
-}
-
-mstGraph::~mstGraph(){
-    //deleteMatrix();
-}
-
-void mstGraph::AddEdge(int start, int end, int weight){
-    adjMatrix[start][end] = weight;
-}
-
-void mstGraph::InitializeMatrix(){
-    adjMatrix = new int*[numVertex];
-    for (int i = 0; i < numVertex; i++)
-        adjMatrix[i] = new int[numVertex];
-
-    for (int i = 0; i < numVertex; i++)
-        for (int j = 0; j < numVertex; j++)
-            adjMatrix[i][j] = -1;
-
-    QSqlQuery query;
-    query.prepare("SELECT id,distanceTo "
-                  "FROM distance "
-                  "WHERE beginStadium "
-                  "IN(SELECT endStadium "
-                  "FROM distance WHERE id = :teamID) "
-                  "AND endStadium = (SELECT beginStadium "
-                  "FROM distance WHERE id = :teamID) AND id!= :teamID");
-
-    QLocale c(QLocale::C);  // variable to convert a formatted string into an int
-    for (int i = 0; i <numVertex; i++)
-    {
-        query.bindValue(":teamID", i);
-        if(query.exec())
-        {
-            while(query.next())
-            {
-				AddEdge(i,query.value(0).toInt(),c.toInt(query.value(1).toString()));
-            }
-        }
-    }
-}
-
-void mstGraph::DeleteMatrix(){
-    for (int i = 0; i < numVertex; i++)
-        delete[] adjMatrix[i];
-    delete[] adjMatrix;
-}
-
-bool mstGraph::isExist(mstVertex search)
-{
-	for (int i = 0; i < (int) mstVec.size(); i++)
-        if (mstVec[i]->index == search.index)
-            return true;
-    return false;
-}
-
-mstVertex* mstGraph::ExtractMin() {
-    if(!mstVec.empty()) {
-        mstVertex* temp = mstVec[0];
-        int smallestIndex = 0;
-		for (int i = 0; i < (int) mstVec.size(); i++) {
-            if (temp->key > mstVec[i]->key) {
-                temp = mstVec[i];
-                smallestIndex = i;
-            }
-        }
-        swap(mstVec[smallestIndex], mstVec[mstVec.size()-1]);
-        mstVec.pop_back();
-        return temp;
-    }
-    return nullptr;
-}
-
-void mstGraph::PrimMST(int start){
-    mstVec.clear();
-	for (int i = 0; i < (int) vertices.size(); i++){
-        vertices[i].index = i;
-        vertices[i].key = INT_MAX;
-        vertices[i].parent = nullptr;
-    }
-    vertices[start].key = 0;
-
-	for (int i = 0; i < (int) vertices.size();i++)
-        mstVec.push_back(&vertices[i]);
-
-    while(!mstVec.empty()){
-		mstVertex* smallestVerPtr = ExtractMin();
-        for (int i = 0; i < numVertex; i++){
-            if (adjMatrix[smallestVerPtr->index][i] != -1){
-                if(isExist(vertices[i]) && adjMatrix[smallestVerPtr->index][i] < vertices[i].key){
-                    vertices[i].parent = smallestVerPtr;
-                    vertices[i].key = adjMatrix[smallestVerPtr->index][i];
-                }
-            }
-        }
-    }
-}
-
-void mstGraph::GetMST(vector<mstEdge>& edgeVec){
-	PrimMST(0);
-	for (int i = 0; i < (int) vertices.size(); i++){
-        if (vertices[i].parent != nullptr)
-            edgeVec.push_back(mstEdge(vertices[i].parent->index, vertices[i].index, vertices[i].key));
-    }
-}
-
-long mstGraph::GetMSTdistance(){
-    long sum = 0;
-	for (int i = 0; i < (int) vertices.size(); i++)
-    {
-        if (vertices[i].parent != nullptr)
-            sum += vertices[i].key;
-    }
-    return sum;
-}
+#include"mstGraph.h"
+#include"stadiumgraph.h"
+#include<algorithm>
+
+mstGraph::mstGraph(MstAlgorithm algorithm):algorithm(algorithm),adjacencyValid(false){
+    std::shared_ptr<const StadiumGraph> stadiums = StadiumGraph::instance();
+    numVertex = stadiums->Size();
+    vertices.resize(numVertex);
+
+    // vertex indices are the shared graph's vertex indices
+    for (int i = 0; i < numVertex; i++)
+        for (const auto &edge : stadiums->Adjacent(i))
+            AddEdge(i, edge.end, edge.weight);
+}
+
+void mstGraph::SetAlgorithm(MstAlgorithm algorithm){
+    this->algorithm = algorithm;
+}
+
+void mstGraph::AddEdge(int start, int end, int weight){
+    edges.push_back(mstEdge(start, end, weight));
+    adjacencyValid = false;
+}
+
+void mstGraph::BuildAdjacency(){
+    undirected.clear();
+    undirected.reserve(edges.size());
+    for (const mstEdge& edge : edges)
+        if (edge.start != edge.end)
+            undirected.push_back(mstEdge(min(edge.start, edge.end), max(edge.start, edge.end), edge.weight));
+
+    // lightest edge of each pair first, then drop the rest of the pair
+    sort(undirected.begin(), undirected.end(), [](const mstEdge& a, const mstEdge& b){
+        if (a.start != b.start)
+            return a.start < b.start;
+        if (a.end != b.end)
+            return a.end < b.end;
+        return a.weight < b.weight;
+    });
+    undirected.erase(unique(undirected.begin(), undirected.end(), [](const mstEdge& a, const mstEdge& b){
+        return a.start == b.start && a.end == b.end;
+    }), undirected.end());
+
+    vector<vector<generalContainer::node>> lists(numVertex);
+    for (const mstEdge& edge : undirected){
+        lists[edge.start].push_back(generalContainer::node(edge.end, edge.weight));
+        lists[edge.end].push_back(generalContainer::node(edge.start, edge.weight));
+    }
+    adjacency.build(lists);
+    adjacencyValid = true;
+}
+
+bool mstGraph::Lighter(int weight, int u, int v, int than) const{
+    // equal weights are ordered by (smaller, larger) endpoint, so the tree is
+    // unique and Prim and Kruskal agree on it
+    const mstVertex& current = vertices[than];
+    if (weight != current.key)
+        return weight < current.key;
+    if (current.parent == nullptr)
+        return false;
+    int p = current.parent->index;
+    return make_pair(min(u, v), max(u, v)) < make_pair(min(p, than), max(p, than));
+}
+
+bool mstGraph::HeapLess(int a, int b) const{
+    if (vertices[a].key != vertices[b].key || vertices[a].parent == nullptr)
+        return vertices[a].key < vertices[b].key;
+    return Lighter(vertices[a].key, vertices[a].parent->index, a, b);
+}
+
+void mstGraph::SiftUp(int pos){
+    int vertex = heap[pos];
+    while (pos > 0){
+        int parent = (pos - 1) / 2;
+        if (!HeapLess(vertex, heap[parent]))
+            break;
+        heap[pos] = heap[parent];
+        heapPos[heap[pos]] = pos;
+        pos = parent;
+    }
+    heap[pos] = vertex;
+    heapPos[vertex] = pos;
+}
+
+void mstGraph::SiftDown(int pos){
+    int vertex = heap[pos];
+    int size = heap.size();
+    while (2 * pos + 1 < size){
+        int child = 2 * pos + 1;
+        if (child + 1 < size && HeapLess(heap[child + 1], heap[child]))
+            child++;
+        if (!HeapLess(heap[child], vertex))
+            break;
+        heap[pos] = heap[child];
+        heapPos[heap[pos]] = pos;
+        pos = child;
+    }
+    heap[pos] = vertex;
+    heapPos[vertex] = pos;
+}
+
+mstVertex* mstGraph::ExtractMin() {
+    if (heap.empty())
+        return nullptr;
+
+    int smallest = heap[0];
+    heapPos[smallest] = -1;
+    heap[0] = heap.back();
+    heap.pop_back();
+    if (!heap.empty())
+        SiftDown(0);
+    return &vertices[smallest];
+}
+
+void mstGraph::PrimMST(int start){
+	for (int i = 0; i < (int) vertices.size(); i++){
+        vertices[i].index = i;
+        vertices[i].key = INT_MAX;
+        vertices[i].parent = nullptr;
+    }
+    vertices[start].key = 0;
+
+    inMST.assign(numVertex, false);
+    heap.resize(numVertex);
+    heapPos.resize(numVertex);
+    for (int i = 0; i < numVertex; i++){
+        heap[i] = i;
+        heapPos[i] = i;
+    }
+    SiftUp(heapPos[start]);
+
+    while(!heap.empty()){
+		mstVertex* smallestVerPtr = ExtractMin();
+        int u = smallestVerPtr->index;
+        inMST[u] = true;
+        for (const auto& edge : adjacency.adjacent(u)){
+            int i = edge.end;
+            if (!inMST[i] && Lighter(edge.weight, u, i, i)){
+                vertices[i].parent = smallestVerPtr;
+                vertices[i].key = edge.weight;
+                SiftUp(heapPos[i]);
+            }
+        }
+    }
+}
+
+namespace {
+    /**
+     * @brief The DisjointSet struct tracks which trees the vertices belong to
+     * (union-find with path compression and union by rank)
+     */
+    struct DisjointSet{
+        vector<int> parent;
+        vector<int> rank;
+
+        explicit DisjointSet(int size):parent(size),rank(size, 0){
+            for (int i = 0; i < size; i++)
+                parent[i] = i;
+        }
+
+        int Find(int x){
+            while (parent[x] != x){
+                parent[x] = parent[parent[x]];
+                x = parent[x];
+            }
+            return x;
+        }
+
+        bool Union(int a, int b){
+            a = Find(a);
+            b = Find(b);
+            if (a == b)
+                return false;
+            if (rank[a] < rank[b])
+                swap(a, b);
+            parent[b] = a;
+            if (rank[a] == rank[b])
+                rank[a]++;
+            return true;
+        }
+    };
+}
+
+void mstGraph::KruskalMST(int start){
+    vector<mstEdge> sorted(undirected);
+    sort(sorted.begin(), sorted.end(), [](const mstEdge& a, const mstEdge& b){
+        if (a.weight != b.weight)
+            return a.weight < b.weight;
+        return make_pair(a.start, a.end) < make_pair(b.start, b.end);
+    });
+
+    // tree edges as an adjacency list, to root the tree afterwards
+    vector<vector<mstEdge>> tree(numVertex);
+    DisjointSet sets(numVertex);
+    for (const mstEdge& edge : sorted){
+        if (sets.Union(edge.start, edge.end)){
+            tree[edge.start].push_back(edge);
+            tree[edge.end].push_back(mstEdge(edge.end, edge.start, edge.weight));
+        }
+    }
+
+	for (int i = 0; i < (int) vertices.size(); i++){
+        vertices[i].index = i;
+        vertices[i].key = INT_MAX;
+        vertices[i].parent = nullptr;
+    }
+    vertices[start].key = 0;
+
+    // walk the tree from start so every vertex points at its parent
+    inMST.assign(numVertex, false);
+    inMST[start] = true;
+    vector<int> stack(1, start);
+    while (!stack.empty()){
+        int u = stack.back();
+        stack.pop_back();
+        for (const mstEdge& edge : tree[u]){
+            if (!inMST[edge.end]){
+                inMST[edge.end] = true;
+                vertices[edge.end].parent = &vertices[u];
+                vertices[edge.end].key = edge.weight;
+                stack.push_back(edge.end);
+            }
+        }
+    }
+}
+
+void mstGraph::GetMST(vector<mstEdge>& edgeVec){
+	if (numVertex == 0)
+		return;
+	if (!adjacencyValid)
+		BuildAdjacency();
+	if (algorithm == MstAlgorithm::Kruskal)
+		KruskalMST(0);
+	else
+		PrimMST(0);
+	for (int i = 0; i < (int) vertices.size(); i++){
+        if (vertices[i].parent != nullptr)
+            edgeVec.push_back(mstEdge(vertices[i].parent->index, vertices[i].index, vertices[i].key));
+    }
+}
+
+long mstGraph::GetMSTdistance(){
+    long sum = 0;
+	for (int i = 0; i < (int) vertices.size(); i++)
+    {
+        if (vertices[i].parent != nullptr)
+            sum += vertices[i].key;
+    }
+    return sum;
+}
@@ -1,104 +1,143 @@
-#ifndef MSTGRAPH_H
-#define MSTGRAPH_H
-
-#include<vector>
-#include<iostream>
-#include<string>
-#include<climits>
-#include<iomanip>
-#include"dbmanager.h"
-
-using namespace std;
-
-/**
- * @brief The mstEdge struct represents an edge in the graph
- */
-struct mstEdge{
-    int start;
-    int end;
-    int weight;
-    mstEdge(int start, int end, int weight):start(start),end(end),weight(weight){}
-};
-
-/**
- * @brief The mstVertex struct represents a vertex in the graph
- */
-struct mstVertex{
-    int key;
-    int index;
-    mstVertex* parent; //parent node
-};
-
-/**
- * @brief The mstGraph class represent the graph of stadiums
- */
-class mstGraph{
-private:
-    vector<mstVertex> vertices;    //Vector to store the vertices
-    int numVertex; // number of vertices
-    int** adjMatrix;    // adjacency matrix
-
-    vector<mstVertex*> mstVec; // vector working as a priority queue
-
-    /**
-     * @brief Function to create the adjacency matrix and initialize all the element to -1
-     **/
-	void InitializeMatrix();
-
-    /**
-     * @brief Function to delete the matrix
-     **/
-	void DeleteMatrix();
-
-    /**
-     * @brief Function to find the minimum value for MST and remove from the "queue"
-     * @return the pointer to the vertex with the minimum key
-     **/
-	mstVertex* ExtractMin();
-
-    /**
-     * @brief Function to do the MST
-     * @param start: starting location
-     */
-	void PrimMST(int start);
-
-
-
-    /**
-     * @brief Function to check if the vertex is in the mstVec
-     * @param search: vertex to be checked
-     **/
-    bool isExist(mstVertex search);
-
-public:
-    /**
-     * @brief Default constructor
-     **/
-    mstGraph();
-
-    /**
-     * @brief Function to add an edge into the adjacency matrix
-     * @param start: starting location
-     * @param end: ending location
-     * @param weight: distance between 2 states
-     **/
-	void AddEdge(int start, int end,int weight);
-
-    /**
-     * @brief Function to get the total mileage of the MST
-     * @return total mileage of MST
-     **/
-	long GetMSTdistance();
-
-    /**
-     * @brief Function to do the MST and store the edges into a vector
-     */
-	void GetMST(vector<mstEdge>&);
-
-    /**
-     * Class destructor
-     **/
-    ~mstGraph();
-};
-
-#endif // MSTGRAPH_H
+#ifndef MSTGRAPH_H
+#define MSTGRAPH_H
+
+#include<vector>
+#include<iostream>
+#include<string>
+#include<climits>
+#include<iomanip>
+#include"bfsNamespace.h"
+
+using namespace std;
+
+/**
+ * @brief The mstEdge struct represents an edge in the graph
+ */
+struct mstEdge{
+    int start;
+    int end;
+    int weight;
+    mstEdge(int start, int end, int weight):start(start),end(end),weight(weight){}
+};
+
+/**
+ * @brief The mstVertex struct represents a vertex in the graph
+ */
+struct mstVertex{
+    int key;
+    int index;
+    mstVertex* parent; //parent node
+};
+
+/**
+ * @brief The MstAlgorithm enum selects how mstGraph builds the spanning tree
+ */
+enum class MstAlgorithm{
+    Prim,   // grows the tree from a vertex with an indexed binary heap
+    Kruskal // adds the shortest edges that join two trees, with union-find
+};
+
+/**
+ * @brief The mstGraph class represent the graph of stadiums
+ */
+class mstGraph{
+private:
+    vector<mstVertex> vertices;    //Vector to store the vertices
+    int numVertex; // number of vertices
+    MstAlgorithm algorithm; // algorithm used by GetMST
+    vector<mstEdge> edges;   // edges as added, one per direction
+    vector<mstEdge> undirected; // one edge per vertex pair (start < end), lighter weight kept
+    generalContainer::csrGraph adjacency; // undirected edges of each vertex, built from edges
+    bool adjacencyValid; // false after AddEdge until BuildAdjacency runs
+
+    vector<int> heap;    // indexed binary heap of vertex indices ordered by key
+    vector<int> heapPos; // position of each vertex in heap, -1 once extracted
+    vector<bool> inMST;  // vertices already added to the tree
+
+    /**
+     * @brief Function to merge the added edges into the undirected edge list and adjacency
+     **/
+    void BuildAdjacency();
+
+    /**
+     * @brief Function to check if edge u-v is lighter than the edge that currently connects a vertex
+     * @param weight: weight of u-v
+     * @param u: first vertex
+     * @param v: second vertex
+     * @param than: vertex whose key and parent give the other edge
+     * @return true if u-v comes first in (weight, smaller vertex, larger vertex) order
+     **/
+    bool Lighter(int weight, int u, int v, int than) const;
+
+    /**
+     * @brief Function to compare 2 vertices in the heap by the edges that connect them
+     * @return true if a comes before b
+     **/
+    bool HeapLess(int a, int b) const;
+
+    /**
+     * @brief Function to move a vertex towards the top of the heap until its parent's key is smaller
+     * @param pos: position in the heap
+     **/
+    void SiftUp(int pos);
+
+    /**
+     * @brief Function to move a vertex towards the bottom of the heap until its children's keys are larger
+     * @param pos: position in the heap
+     **/
+    void SiftDown(int pos);
+
+    /**
+     * @brief Function to remove the vertex with the minimum key from the heap
+     * @return the pointer to the vertex with the minimum key
+     **/
+	mstVertex* ExtractMin();
+
+    /**
+     * @brief Function to do the MST with Prim's algorithm, O(E log V)
+     * @param start: starting location
+     */
+	void PrimMST(int start);
+
+    /**
+     * @brief Function to do the MST with Kruskal's algorithm, O(E log E); the tree is then
+     * rooted at start so the parents match PrimMST
+     * @param start: starting location
+     */
+	void KruskalMST(int start);
+
+public:
+    /**
+     * @brief Default constructor
+     * @param algorithm: algorithm used by GetMST
+     **/
+    explicit mstGraph(MstAlgorithm algorithm = MstAlgorithm::Prim);
+
+    /**
+     * @brief Function to choose the algorithm used by the next GetMST
+     * @param algorithm: Prim or Kruskal
+     **/
+    void SetAlgorithm(MstAlgorithm algorithm);
+
+    /**
+     * @brief Function to add an edge to the graph; edges are undirected and the lighter
+     * weight wins when both directions are added
+     * @param start: starting location
+     * @param end: ending location
+     * @param weight: distance between 2 states
+     **/
+	void AddEdge(int start, int end,int weight);
+
+    /**
+     * @brief Function to get the total mileage of the MST
+     * @return total mileage of MST
+     **/
+	long GetMSTdistance();
+
+    /**
+     * @brief Function to do the MST and store the edges into a vector
+     */
+	void GetMST(vector<mstEdge>&);
+};
+
+#endif // MSTGRAPH_H
@@ -0,0 +1,16 @@
+# Builds the core library, the command line planner, the benchmarks, the
+# hash table benchmark and the GUI together. app.pro still builds the GUI
+# on its own.
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    core \
+    cli \
+    benchmarks \
+    hashbench \
+    gui
+
+cli.depends = core
+benchmarks.depends = core
+gui.file = app.pro
@@ -0,0 +1,182 @@
+#include "schema.h"
+#include <QtSql/QSqlQuery>
+#include <QtSql/QSqlError>
+#include <QDebug>
+
+namespace {
+	// text such as "$1,234.50" as integer cents
+	const char *CENTS = "CAST(ROUND(CAST(REPLACE(REPLACE(%1, '$', ''), ',', '') AS REAL) * 100) AS INTEGER)";
+
+	// text such as "63,400" as an integer
+	const char *INTEGER = "CAST(REPLACE(%1, ',', '') AS INTEGER)";
+}
+
+int Schema::Version(QSqlDatabase db)
+{
+	QSqlQuery query(db);
+	if (!query.exec("PRAGMA user_version") || !query.next()) {
+		qDebug() << "Schema::Version() : query failed";
+		return -1;
+	}
+	return query.value(0).toInt();
+}
+
+bool Schema::Migrate(QSqlDatabase db)
+{
+	int version = Version(db);
+	if (version < 0)
+		return false;
+	if (version >= VERSION)
+		return true;
+
+	if (!db.transaction()) {
+		qDebug() << "Schema::Migrate() : could not start a transaction";
+		return false;
+	}
+
+	bool ok = true;
+	if (version < 1)
+		ok = MigrateToTypedColumns(db);
+	if (ok && version < 2)
+		ok = CreateTables(db) && CreateIndexes(db) && RefreshEdges(db);
+
+	QSqlQuery query(db);
+	if (ok)
+		ok = query.exec(QString("PRAGMA user_version = %1").arg(VERSION));
+
+	if (!ok || !db.commit()) {
+		qDebug() << "Schema::Migrate() : migration to version" << VERSION
+				 << "failed, rolled back:" << query.lastError().text();
+		db.rollback();
+		return false;
+	}
+	qDebug() << "Schema::Migrate() : migrated from version" << version << "to" << VERSION;
+	Analyze(db);
+	return true;
+}
+
+void Schema::Analyze(QSqlDatabase db)
+{
+	QSqlQuery query(db);
+	if (!query.exec("ANALYZE"))
+		qDebug() << "Schema::Analyze() : query failed" << query.lastError().text();
+}
+
+bool Schema::Exec(QSqlDatabase db, const QStringList &statements)
+{
+	QSqlQuery query(db);
+	for (const QString &statement : statements) {
+		if (!query.exec(statement)) {
+			qDebug() << "Schema::Exec() :" << statement << query.lastError().text();
+			return false;
+		}
+	}
+	return true;
+}
+
+bool Schema::Rebuild(QSqlDatabase db, const QString &table,
+					 const QString &definition, const QString &select)
+{
+	if (!db.tables().contains(table))
+		return true;	// nothing to convert
+
+	return Exec(db, {
+		QString("CREATE TABLE %1_new(%2)").arg(table, definition),
+		QString("INSERT INTO %1_new SELECT %2 FROM %1 ORDER BY rowid").arg(table, select),
+		QString("DROP TABLE %1").arg(table),
+		QString("ALTER TABLE %1_new RENAME TO %1").arg(table)
+	});
+}
+
+bool Schema::MigrateToTypedColumns(QSqlDatabase db)
+{
+	return Rebuild(db, "information",
+				   "id INTEGER, stadiumName TEXT, seatCap INTEGER, location TEXT, "
+				   "conference TEXT, division TEXT, surfaceType TEXT, roofType TEXT, "
+				   "dateOpen INTEGER, "
+				   "FOREIGN KEY(id) REFERENCES teams(id) ON DELETE CASCADE",
+				   QString("id, stadiumName, %1, location, conference, division, "
+						   "surfaceType, roofType, %2")
+						   .arg(QString(INTEGER).arg("seatCap"), QString(INTEGER).arg("dateOpen")))
+		&& Rebuild(db, "distance",
+				   "id INTEGER, beginStadium TEXT, endStadium TEXT, distanceTo INTEGER, "
+				   "FOREIGN KEY(id) REFERENCES teams(id) ON DELETE CASCADE",
+				   QString("id, beginStadium, endStadium, %1").arg(QString(INTEGER).arg("distanceTo")))
+		&& Rebuild(db, "souvenir",
+				   "id INTEGER, items TEXT, price INTEGER, "
+				   "FOREIGN KEY(id) REFERENCES teams(id) ON DELETE CASCADE",
+				   QString("id, items, %1").arg(QString(CENTS).arg("price")))
+		&& Rebuild(db, "purchases",
+				   "teamID INTEGER, purchaseID INTEGER, items TEXT, price INTEGER, "
+				   "quantity INTEGER, "
+				   "FOREIGN KEY(teamID) REFERENCES teams(id) ON DELETE CASCADE",
+				   QString("teamID, purchaseID, items, %1, %2")
+						   .arg(QString(CENTS).arg("price"), QString(INTEGER).arg("quantity")));
+}
+
+bool Schema::CreateTables(QSqlDatabase db)
+{
+	// same layout dbScript.py writes, so a missing Data.db starts out usable
+	bool seedAccounts = !db.tables().contains("accounts");
+
+	return Exec(db, {
+		"CREATE TABLE IF NOT EXISTS teams(id INTEGER PRIMARY KEY AUTOINCREMENT, teamNames TEXT)",
+		"CREATE TABLE IF NOT EXISTS information(id INTEGER, stadiumName TEXT, "
+		"seatCap INTEGER, location TEXT, conference TEXT, division TEXT, "
+		"surfaceType TEXT, roofType TEXT, dateOpen INTEGER, "
+		"FOREIGN KEY(id) REFERENCES teams(id) ON DELETE CASCADE)",
+		"CREATE TABLE IF NOT EXISTS distance(id INTEGER, beginStadium TEXT, "
+		"endStadium TEXT, distanceTo INTEGER, "
+		"FOREIGN KEY(id) REFERENCES teams(id) ON DELETE CASCADE)",
+		"CREATE TABLE IF NOT EXISTS souvenir(id INTEGER, items TEXT, price INTEGER, "
+		"FOREIGN KEY(id) REFERENCES teams(id) ON DELETE CASCADE)",
+		"CREATE TABLE IF NOT EXISTS accounts(username TEXT, password TEXT, level TEXT)",
+		"CREATE TABLE IF NOT EXISTS purchases(teamID INTEGER, purchaseID INTEGER, "
+		"items TEXT, price INTEGER, quantity INTEGER, "
+		"FOREIGN KEY(teamID) REFERENCES teams(id) ON DELETE CASCADE)",
+		"CREATE TABLE IF NOT EXISTS edges(from_team INTEGER NOT NULL, "
+		"to_team INTEGER NOT NULL, distance INTEGER NOT NULL, "
+		"PRIMARY KEY(from_team, to_team), "
+		"FOREIGN KEY(from_team) REFERENCES teams(id) ON DELETE CASCADE, "
+		"FOREIGN KEY(to_team) REFERENCES teams(id) ON DELETE CASCADE) WITHOUT ROWID"
+	}) && (!seedAccounts || Exec(db, {
+		"INSERT INTO accounts(username, password, level) VALUES('admin', 'password', 'ADMIN')"
+	}));
+}
+
+bool Schema::CreateIndexes(QSqlDatabase db)
+{
+	return Exec(db, {
+		// name -> id for imports and the souvenir subqueries
+		"CREATE INDEX IF NOT EXISTS teams_name ON teams(teamNames)",
+		"CREATE INDEX IF NOT EXISTS information_team ON information(id)",
+		// per-team rows, and the endStadium join that derives edges
+		"CREATE INDEX IF NOT EXISTS distance_team ON distance(id, endStadium, beginStadium, distanceTo)",
+		"CREATE INDEX IF NOT EXISTS distance_end ON distance(endStadium, beginStadium, id)",
+		"CREATE INDEX IF NOT EXISTS souvenir_team ON souvenir(id, items, price)",
+		// receipts by id, newest id (GetNewID) and the purchase id list
+		"CREATE INDEX IF NOT EXISTS purchases_receipt ON purchases(purchaseID, teamID, items, price, quantity)",
+		// cascading team deletes
+		"CREATE INDEX IF NOT EXISTS purchases_team ON purchases(teamID)",
+		"CREATE INDEX IF NOT EXISTS edges_to ON edges(to_team)"
+	});
+}
+
+bool Schema::RefreshEdges(QSqlDatabase db)
+{
+	// A team's stadium is the beginStadium of its first row. Team v is
+	// adjacent to team u when one of u's rows ends at v's stadium and starts
+	// from a stadium v lists as a destination; the edge carries u's mileage.
+	// Teams sharing a stadium connect through their same-stadium row
+	return Exec(db, {
+		"DELETE FROM edges",
+		"INSERT OR IGNORE INTO edges(from_team, to_team, distance) "
+		"SELECT back.id, route.id, route.distanceTo "
+		"FROM distance route "
+		"JOIN distance back ON back.endStadium = route.beginStadium AND back.id <> route.id "
+		"JOIN teams source ON source.id = back.id "
+		"JOIN teams target ON target.id = route.id "
+		"WHERE route.endStadium = (SELECT beginStadium FROM distance "
+		"WHERE distance.id = back.id ORDER BY rowid LIMIT 1)"
+	});
+}
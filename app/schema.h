@@ -0,0 +1,70 @@
+#ifndef SCHEMA_H
+#define SCHEMA_H
+
+#include <QtSql/QSqlDatabase>
+#include <QStringList>
+
+/*!
+ * @class Schema
+ * @brief Upgrades Data.db to the layout this build expects. The layout
+ * version is kept in PRAGMA user_version; each step runs once, inside a
+ * transaction, and a failed step is rolled back leaving the file untouched
+ */
+class Schema {
+public:
+	/*!
+	 * @brief version 1: numeric columns are INTEGER (seatCap, dateOpen,
+	 * distanceTo, quantity) and prices are INTEGER cents.
+	 * version 2: every table is created here when missing, lookups have
+	 * covering indexes and team adjacency lives in the integer edges table
+	 */
+	static const int VERSION = 2;
+
+	/*!
+	 * @brief Brings the database up to VERSION
+	 * @param db; open database
+	 * @return true if the database is at VERSION afterwards
+	 */
+	static bool Migrate(QSqlDatabase db);
+
+	/*!
+	 * @brief Version stored in the database
+	 * @param db; open database
+	 * @return user_version, -1 if it could not be read
+	 */
+	static int Version(QSqlDatabase db);
+
+	/*!
+	 * @brief Recomputes the edges table from the distance table. Call after
+	 * distance rows change; StadiumGraph reads edges, not distance
+	 * @param db; open database
+	 * @return true on success
+	 */
+	static bool RefreshEdges(QSqlDatabase db);
+
+	/*!
+	 * @brief Refreshes the planner statistics (ANALYZE). Call after bulk loads
+	 * so the new indexes are chosen over table scans
+	 * @param db; open database
+	 */
+	static void Analyze(QSqlDatabase db);
+
+private:
+	// converts the TEXT numeric columns written by dbScript.py
+	static bool MigrateToTypedColumns(QSqlDatabase db);
+
+	// creates the tables missing from an empty or partial database
+	static bool CreateTables(QSqlDatabase db);
+
+	// covering indexes for the team, distance, souvenir and purchase lookups
+	static bool CreateIndexes(QSqlDatabase db);
+
+	// runs each statement in order, stopping at the first failure
+	static bool Exec(QSqlDatabase db, const QStringList &statements);
+
+	// recreates table with the given definition, copying rows through select
+	static bool Rebuild(QSqlDatabase db, const QString &table,
+						const QString &definition, const QString &select);
+};
+
+#endif // SCHEMA_H
@@ -0,0 +1,62 @@
+#include "shortestpath.h"
+#include <algorithm>
+#include <functional>
+
+ShortestPath::ShortestPath(const generalContainer::csrGraph &graph)
+	: graph{graph}, source{-1} {}
+
+void ShortestPath::Run(int start)
+{
+	const int size = graph.numVertices();
+	const std::greater<HeapEntry> minHeap;
+
+	source = start;
+	costs.assign(size, UNREACHABLE);
+	parents.assign(size, -1);
+	settled.assign(size, false);
+	order.clear();
+	heap.clear();
+
+	if (start < 0 || start >= size)
+		return;
+
+	costs[start] = 0;
+	heap.push_back(HeapEntry{0, start});
+
+	while (!heap.empty()) {
+		std::pop_heap(heap.begin(), heap.end(), minHeap);
+		HeapEntry top = heap.back();
+		heap.pop_back();
+
+		int vertex = top.second;
+		if (settled[vertex] || top.first > costs[vertex])
+			continue;	// stale entry left behind by a shorter path
+
+		settled[vertex] = true;
+		order.push_back(vertex);
+
+		for (const auto &edge : graph.adjacent(vertex)) {
+			int cost = top.first + edge.weight;
+			if (!settled[edge.end] && cost < costs[edge.end]) {
+				costs[edge.end] = cost;
+				parents[edge.end] = vertex;
+				heap.push_back(HeapEntry{cost, edge.end});
+				std::push_heap(heap.begin(), heap.end(), minHeap);
+			}
+		}
+	}
+}
+
+std::vector<int> ShortestPath::Path(int vertex) const
+{
+	std::vector<int> path;
+
+	if (vertex < 0 || vertex >= (int) costs.size() || costs[vertex] == UNREACHABLE)
+		return path;
+
+	for (int v = vertex; v != -1; v = parents[v])
+		path.push_back(v);
+
+	std::reverse(path.begin(), path.end());
+	return path;
+}
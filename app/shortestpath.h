@@ -0,0 +1,89 @@
+#ifndef SHORTESTPATH_H
+#define SHORTESTPATH_H
+
+#include <climits>
+#include <utility>
+#include <vector>
+#include "bfsNamespace.h"
+
+/*!
+ * @class ShortestPath
+ * @brief Dijkstra over a csr adjacency using a binary heap with lazy
+ * deletion, O(E log V) per source. Buffers are kept between runs so
+ * repeated queries on the same graph do not reallocate
+ */
+class ShortestPath {
+public:
+	/// cost of a vertex that cannot be reached from the source
+	static constexpr int UNREACHABLE = INT_MAX;
+
+	/*!
+	 * @brief Constructor
+	 * @param graph; adjacency to search, must outlive this object
+	 */
+	explicit ShortestPath(const generalContainer::csrGraph &graph);
+
+	/*!
+	 * @brief runs dijkstra from a source vertex
+	 * @param start; source vertex index
+	 */
+	void Run(int start);
+
+	/*!
+	 * @brief source of the last run
+	 * @return vertex index
+	 */
+	int Source() const { return source; }
+
+	/*!
+	 * @brief shortest distance from the source
+	 * @param vertex
+	 * @return distance, UNREACHABLE if there is no path
+	 */
+	int Cost(int vertex) const { return costs[vertex]; }
+
+	/*!
+	 * @brief previous vertex on the shortest path
+	 * @param vertex
+	 * @return vertex index, -1 for the source and unreachable vertices
+	 */
+	int Parent(int vertex) const { return parents[vertex]; }
+
+	/*!
+	 * @brief distances of every vertex from the source
+	 * @return costs indexed by vertex
+	 */
+	const std::vector<int> &Costs() const { return costs; }
+
+	/*!
+	 * @brief parent of every vertex on its shortest path
+	 * @return parents indexed by vertex
+	 */
+	const std::vector<int> &Parents() const { return parents; }
+
+	/*!
+	 * @brief reachable vertices in the order they were settled
+	 * @return list of vertices, source first
+	 */
+	const std::vector<int> &Order() const { return order; }
+
+	/*!
+	 * @brief shortest path from the source to a vertex
+	 * @param vertex; end of the path
+	 * @return vertices from the source to vertex, empty if unreachable
+	 */
+	std::vector<int> Path(int vertex) const;
+
+private:
+	typedef std::pair<int, int> HeapEntry;	/// (cost, vertex)
+
+	const generalContainer::csrGraph &graph;
+	int source;
+	std::vector<int> costs;
+	std::vector<int> parents;
+	std::vector<int> order;
+	std::vector<char> settled;
+	std::vector<HeapEntry> heap;	/// min heap, stale entries skipped on pop
+};
+
+#endif // SHORTESTPATH_H
@@ -0,0 +1,87 @@
+#include "stadiumgraph.h"
+#include <atomic>
+#include <QtSql/QSqlQuery>
+#include <QDebug>
+#include <QCryptographicHash>
+
+namespace {
+	std::shared_ptr<const StadiumGraph> current;	/// published snapshot
+	std::atomic<unsigned> lastVersion{0};	/// version of the newest build
+}
+
+std::shared_ptr<const StadiumGraph> StadiumGraph::instance()
+{
+	std::shared_ptr<const StadiumGraph> graph = std::atomic_load(&current);
+	if (!graph) {
+		Rebuild();
+		graph = std::atomic_load(&current);
+	}
+	return graph;
+}
+
+void StadiumGraph::Rebuild()
+{
+	std::shared_ptr<const StadiumGraph> graph(new StadiumGraph(++lastVersion));
+	std::atomic_store(&current, graph);
+}
+
+StadiumGraph::StadiumGraph(unsigned version) : version{version}
+{
+	QSqlQuery query;
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+	query.setForwardOnly(true);
+
+	if (!query.exec("SELECT id, teamNames FROM teams ORDER BY id")) {
+		qDebug() << "StadiumGraph::StadiumGraph() : teams query failed";
+		adjacency.build({});
+		return;
+	}
+	nameToVertex.max_load_factor(LOAD_FACTOR);
+	idToVertex.max_load_factor(LOAD_FACTOR);
+	while (query.next()) {
+		int vertex = teamNames.size();
+		teamIDs.push_back(query.value(0).toInt());
+		teamNames.push_back(query.value(1).toString());
+		idToVertex[teamIDs.back()] = vertex;
+		nameToVertex[teamNames.back()] = vertex;
+		hash.addData(QString("%1|%2\n").arg(teamIDs.back()).arg(teamNames.back()).toUtf8());
+	}
+
+	// edges is kept by Schema::RefreshEdges; the primary key hands the rows
+	// over grouped by source and ordered by target id
+	if (!query.exec("SELECT from_team, to_team, distance FROM edges "
+					"ORDER BY from_team, to_team")) {
+		qDebug() << "StadiumGraph::StadiumGraph() : edges query failed";
+		adjacency.build(std::vector<std::vector<generalContainer::node>>(Size()));
+		return;
+	}
+
+	std::vector<std::vector<generalContainer::node>> adjList(Size());
+	while (query.next()) {
+		int from = query.value(0).toInt();
+		int to = query.value(1).toInt();
+		int distance = query.value(2).toInt();
+		hash.addData(QString("%1|%2|%3\n").arg(from).arg(to).arg(distance).toUtf8());
+
+		int u = FindVertexByID(from);
+		int v = FindVertexByID(to);
+		if (u != -1 && v != -1)
+			adjList[u].push_back(generalContainer::node(v, distance));
+	}
+	query.finish();
+	checksum = hash.result();
+
+	adjacency.build(adjList);
+}
+
+int StadiumGraph::FindVertex(QStringView teamName) const
+{
+	auto found = nameToVertex.find(teamName);
+	return found == nameToVertex.end() ? -1 : found->second;
+}
+
+int StadiumGraph::FindVertexByID(int id) const
+{
+	auto found = idToVertex.find(id);
+	return found == idToVertex.end() ? -1 : found->second;
+}
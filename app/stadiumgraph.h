@@ -0,0 +1,140 @@
+#ifndef STADIUMGRAPH_H
+#define STADIUMGRAPH_H
+
+#include <memory>
+#include <vector>
+#include <QByteArray>
+#include <QString>
+#include <QHash>
+#include <QStringList>
+#include <QStringView>
+#include "bfsNamespace.h"
+#include "unordered_map.h"
+
+/*!
+ * @class StadiumGraph
+ * @brief Immutable in-memory copy of the edges table. One snapshot is
+ * built from the database and shared by every trip planner; Rebuild()
+ * publishes a new snapshot with a higher version instead of mutating the
+ * one readers may still hold
+ */
+class StadiumGraph {
+public:
+	/*!
+	 * @brief Current snapshot of the graph, built on first use
+	 * @return shared pointer to the snapshot
+	 */
+	static std::shared_ptr<const StadiumGraph> instance();
+
+	/*!
+	 * @brief Reloads the graph from the database. Call after the distance
+	 * table changes (admin edits, team import)
+	 */
+	static void Rebuild();
+
+	/*!
+	 * @brief Deleted copy constructor
+	 */
+	StadiumGraph(const StadiumGraph&) = delete;
+
+	/*!
+	 * @brief Deleted copy assignment
+	 */
+	StadiumGraph& operator=(const StadiumGraph&) = delete;
+
+	/*!
+	 * @brief Version of this snapshot, incremented on every rebuild
+	 * @return version number
+	 */
+	unsigned Version() const { return version; }
+
+	/*!
+	 * @brief Sha1 of the teams and edges rows the snapshot was built from
+	 * @return checksum, empty if the tables could not be read
+	 */
+	const QByteArray &Checksum() const { return checksum; }
+
+	/*!
+	 * @brief number of vertices (teams) in the graph
+	 * @return int
+	 */
+	int Size() const { return teamNames.size(); }
+
+	/*!
+	 * @brief finds the vertex of a team; takes a view so names cut out of
+	 * larger strings are looked up without a copy
+	 * @param teamName
+	 * @return vertex index, -1 if the team is not in the graph
+	 */
+	int FindVertex(QStringView teamName) const;
+
+	/*!
+	 * @brief finds the vertex of a team by its id in the teams table
+	 * @param id; team id
+	 * @return vertex index, -1 if the id is not in the graph
+	 */
+	int FindVertexByID(int id) const;
+
+	/*!
+	 * @brief team name of a vertex
+	 * @param vertex
+	 * @return team name
+	 */
+	const QString &TeamName(int vertex) const { return teamNames[vertex]; }
+
+	/*!
+	 * @brief id in the teams table of a vertex
+	 * @param vertex
+	 * @return team id
+	 */
+	int TeamID(int vertex) const { return teamIDs[vertex]; }
+
+	/*!
+	 * @brief all team names ordered by vertex
+	 * @return QStringList
+	 */
+	const QStringList &TeamNames() const { return teamNames; }
+
+	/*!
+	 * @brief edges leaving a vertex ordered by target team id
+	 * @param vertex
+	 * @return range of nodes; node.end is a vertex index
+	 */
+	generalContainer::nodeRange Adjacent(int vertex) const
+	{ return adjacency.adjacent(vertex); }
+
+	/*!
+	 * @brief compact adjacency used by the path finding engines
+	 * @return csr adjacency indexed by vertex
+	 */
+	const generalContainer::csrGraph &Csr() const { return adjacency; }
+
+private:
+	/*!
+	 * @brief Builds a snapshot from the teams and edges tables
+	 * @param version; version number of the new snapshot
+	 */
+	explicit StadiumGraph(unsigned version);
+
+	unsigned version;	/// snapshot version
+	QByteArray checksum;	/// sha1 of the source rows
+	QStringList teamNames;	/// vertex -> team name
+	std::vector<int> teamIDs;	/// vertex -> team id
+	generalContainer::csrGraph adjacency;	/// vertex -> edges
+
+	// transparent, so FindVertex can search with a view
+	struct NameHash {
+		using is_transparent = void;
+		size_t operator()(QStringView name) const { return qHash(name); }
+	};
+	struct NameEqual {
+		using is_transparent = void;
+		bool operator()(QStringView lhs, QStringView rhs) const { return lhs == rhs; }
+	};
+	// built once per snapshot and only read after that
+	static constexpr float LOAD_FACTOR = 0.5f;
+	nonstd::unordered_map<QString, int, NameHash, NameEqual> nameToVertex;
+	nonstd::unordered_map<int, int> idToVertex;
+};
+
+#endif // STADIUMGRAPH_H
@@ -0,0 +1,327 @@
+#include "tripplanner.h"
+#include <algorithm>
+#include <bitset>
+#include <climits>
+#include <mutex>
+#include <random>
+#include "workerpool.h"
+
+namespace {
+	const size_t CHUNK = 512;	/// subsets handed to a thread at a time
+	const int PARALLEL_LIMIT = 12;	/// fewer stops are solved on one thread
+}
+
+TripPlanner::TripPlanner(std::shared_ptr<const DistanceMatrix> matrix, int threads)
+	: matrix{std::move(matrix)},
+	  threads{threads > 0 ? threads : WorkerPool::DefaultSize()} {}
+
+std::vector<int> TripPlanner::Optimize(int start, const std::vector<int> &stops,
+									   int budgetMs, const Progress &progress)
+{
+	if ((int) stops.size() <= EXACT_LIMIT)
+		return HeldKarp(start, stops, progress);
+	return Restarts(LocalSearch(Greedy(start, stops), budgetMs / 4), budgetMs, progress);
+}
+
+std::vector<int> TripPlanner::Greedy(int start, const std::vector<int> &stops) const
+{
+	std::vector<int> trip{start};
+	std::vector<int> left(stops);
+
+	while (!left.empty()) {
+		// ties go to the lowest vertex, like RecursiveAlgo
+		auto closest = std::min_element(left.begin(), left.end(),
+				[this, &trip](int a, int b) {
+					int da = Distance(trip.back(), a);
+					int db = Distance(trip.back(), b);
+					return da < db || (da == db && a < b);
+				});
+		trip.push_back(*closest);
+		left.erase(closest);
+	}
+	return trip;
+}
+
+std::vector<int> TripPlanner::HeldKarp(int start, const std::vector<int> &stops,
+									   const Progress &progress)
+{
+	const int n = stops.size();
+	if (n == 0)
+		return {start};
+
+	// the local search result is returned if the exact search cannot finish,
+	// and bounds it: no partial trip as long as it can lead anywhere better
+	std::vector<int> fallback = LocalSearch(Greedy(start, stops), 0);
+	const long bound = Length(fallback);
+	if (n > EXACT_LIMIT || bound < 0 || cancelled)
+		return fallback;
+
+	const int UNREACHABLE = ShortestPath::UNREACHABLE;
+	const int full = (1 << n) - 1;
+
+	// distances between the stops, start at index n, copied once so the
+	// inner loop stays in cache
+	std::vector<int> distance((n + 1) * (n + 1));
+	for (int a = 0; a <= n; a++)
+		for (int b = 0; b <= n; b++)
+			distance[a * (n + 1) + b] = Distance(a < n ? stops[a] : start,
+												 b < n ? stops[b] : start);
+
+	// subsets grouped by size; every subset of a layer only reads the layer
+	// before, so a layer can be split between threads without locking
+	std::vector<int> order(full + 1);
+	std::vector<size_t> layer(n + 2, 0);
+	for (int mask = 0; mask <= full; mask++)
+		layer[std::bitset<32>(mask).count() + 1]++;
+	for (int size = 1; size <= n + 1; size++)
+		layer[size] += layer[size - 1];
+	{
+		std::vector<size_t> fill(layer.begin(), layer.end() - 1);
+		for (int mask = 0; mask <= full; mask++)
+			order[fill[std::bitset<32>(mask).count()]++] = mask;
+	}
+
+	// cost[mask * n + j]: shortest trip from start through mask ending at stops[j]
+	std::vector<int> cost((size_t) (full + 1) * n, UNREACHABLE);
+	std::vector<signed char> previous((size_t) (full + 1) * n, -1);
+
+	auto relax = [&](int mask) {
+		for (int j = 0; j < n; j++) {
+			if (!(mask & (1 << j)))
+				continue;
+
+			int rest = mask & ~(1 << j);
+			long best = UNREACHABLE;
+			int from = -1;
+			if (rest == 0) {
+				best = distance[n * (n + 1) + j];
+			} else {
+				for (int k = 0; k < n; k++) {
+					int before = cost[(size_t) rest * n + k];
+					int leg = distance[k * (n + 1) + j];
+					if (!(rest & (1 << k)) || before == UNREACHABLE || leg == UNREACHABLE)
+						continue;
+					if ((long) before + leg < best) {
+						best = (long) before + leg;
+						from = k;
+					}
+				}
+			}
+
+			if (best < bound) {
+				cost[(size_t) mask * n + j] = best;
+				previous[(size_t) mask * n + j] = from;
+			}
+		}
+	};
+
+	WorkerPool pool(n < PARALLEL_LIMIT ? 1 : threads);
+	std::atomic<size_t> next{0};
+	std::atomic<size_t> done{0};
+	auto poll = [&]() {
+		if (progress && !progress(int(done * 100 / (full + 1))))
+			Cancel();
+	};
+
+	for (int size = 1; size <= n && !cancelled; size++) {
+		const size_t end = layer[size + 1];
+		next = layer[size];
+		pool.Run([&](int) {
+			for (;;) {
+				size_t first = next.fetch_add(CHUNK);
+				if (first >= end || cancelled)
+					return;
+				size_t last = std::min(end, first + CHUNK);
+				for (size_t i = first; i < last; i++)
+					relax(order[i]);
+				done += last - first;
+			}
+		}, poll);
+	}
+
+	int last = 0;
+	for (int j = 1; j < n; j++)
+		if (cost[(size_t) full * n + j] < cost[(size_t) full * n + last])
+			last = j;
+
+	// cancelled, or nothing beat the bound: the local search trip is optimal
+	if (cancelled || cost[(size_t) full * n + last] == UNREACHABLE)
+		return fallback;
+
+	std::vector<int> trip;
+	for (int mask = full, j = last; j != -1; ) {
+		int before = previous[(size_t) mask * n + j];
+		trip.push_back(stops[j]);
+		mask &= ~(1 << j);
+		j = before;
+	}
+	trip.push_back(start);
+	std::reverse(trip.begin(), trip.end());
+	return trip;
+}
+
+std::vector<int> TripPlanner::LocalSearch(std::vector<int> trip, int budgetMs) const
+{
+	if (Length(trip) < 0)	// some leg is unreachable
+		return trip;
+
+	Scratch scratch;
+	QElapsedTimer timer;
+	timer.start();
+	Descend(trip, scratch, timer, budgetMs);
+	return trip;
+}
+
+std::vector<int> TripPlanner::Restarts(std::vector<int> trip, int budgetMs,
+									   const Progress &progress)
+{
+	const int n = trip.size();
+	std::atomic<long> bestLength{Length(trip)};
+
+	// a double bridge needs three cut points after the fixed first stop
+	if (n < 4 || bestLength < 0 || budgetMs <= 0 || cancelled)
+		return trip;
+
+	QElapsedTimer timer;
+	timer.start();
+	std::mutex bestMutex;
+	std::vector<int> best = trip;
+
+	WorkerPool pool(threads);
+	pool.Run([&](int thread) {
+		Scratch scratch;
+		std::mt19937 random(thread + 1);
+		std::uniform_int_distribution<int> cut(1, n - 1);
+		std::vector<int> current, candidate;
+		long currentLength = LONG_MAX;
+
+		while (!cancelled && timer.elapsed() < budgetMs) {
+			// continue from the best trip any thread has found
+			if (currentLength > bestLength) {
+				std::lock_guard<std::mutex> lock(bestMutex);
+				current = best;
+				currentLength = bestLength;
+			}
+
+			int cuts[3];
+			do {
+				cuts[0] = cut(random);
+				cuts[1] = cut(random);
+				cuts[2] = cut(random);
+				std::sort(cuts, cuts + 3);
+			} while (cuts[0] == cuts[1] || cuts[1] == cuts[2]);
+
+			// swap trip[cuts[0]..cuts[1]) with trip[cuts[1]..cuts[2])
+			candidate = current;
+			std::rotate(candidate.begin() + cuts[0], candidate.begin() + cuts[1],
+						candidate.begin() + cuts[2]);
+			Descend(candidate, scratch, timer, budgetMs);
+
+			long length = Length(candidate);
+			if (length < currentLength) {
+				current.swap(candidate);
+				currentLength = length;
+
+				std::lock_guard<std::mutex> lock(bestMutex);
+				if (length < bestLength) {
+					best = current;
+					bestLength = length;
+				}
+			}
+		}
+	}, [&]() {
+		if (progress && !progress(std::min<int>(100, timer.elapsed() * 100 / budgetMs)))
+			Cancel();
+	});
+
+	return best;
+}
+
+long TripPlanner::Length(const std::vector<int> &trip) const
+{
+	return matrix->TripDistance(trip);
+}
+
+void TripPlanner::Descend(std::vector<int> &trip, Scratch &scratch,
+						  const QElapsedTimer &timer, int budgetMs) const
+{
+	bool improved = true;
+	while (improved && !cancelled && (budgetMs <= 0 || timer.elapsed() < budgetMs)) {
+		improved = TwoOpt(trip, scratch);
+		improved = OrOpt(trip, scratch) || improved;
+	}
+}
+
+bool TripPlanner::TwoOpt(std::vector<int> &trip, Scratch &scratch) const
+{
+	const int n = trip.size();
+	bool changed = false;
+
+	// forward[k] / backward[k]: cost of trip[0..k] walked forwards / backwards,
+	// so reversing a segment is O(1) to price even when distances differ
+	// slightly by direction
+	std::vector<long> &forward = scratch.forward;
+	std::vector<long> &backward = scratch.backward;
+	forward.assign(n, 0);
+	backward.assign(n, 0);
+	auto prefix = [&]() {
+		for (int k = 1; k < n; k++) {
+			forward[k] = forward[k - 1] + Distance(trip[k - 1], trip[k]);
+			backward[k] = backward[k - 1] + Distance(trip[k], trip[k - 1]);
+		}
+	};
+	prefix();
+
+	for (int i = 1; i < n - 1; i++) {
+		for (int j = i + 1; j < n; j++) {
+			long before = Distance(trip[i - 1], trip[i]) + forward[j] - forward[i];
+			long after = Distance(trip[i - 1], trip[j]) + backward[j] - backward[i];
+			if (j + 1 < n) {
+				before += Distance(trip[j], trip[j + 1]);
+				after += Distance(trip[i], trip[j + 1]);
+			}
+			if (after < before) {
+				std::reverse(trip.begin() + i, trip.begin() + j + 1);
+				prefix();
+				changed = true;
+			}
+		}
+	}
+	return changed;
+}
+
+bool TripPlanner::OrOpt(std::vector<int> &trip, Scratch &scratch) const
+{
+	const int n = trip.size();
+	bool changed = false;
+
+	// cost of the edge between positions a and b, 0 past the end of the trip
+	auto edge = [&](int a, int b) -> long {
+		return b < n ? Distance(trip[a], trip[b]) : 0;
+	};
+
+	for (int length = 1; length <= 3; length++) {
+		for (int i = 1; i + length <= n; i++) {
+			int j = i + length - 1;	// segment is trip[i..j]
+			long removed = edge(i - 1, i) + edge(j, j + 1);
+			long bridged = j + 1 < n ? Distance(trip[i - 1], trip[j + 1]) : 0;
+
+			// try to insert the segment after position p
+			for (int p = 0; p < n; p++) {
+				if (p >= i - 1 && p <= j)
+					continue;
+				long added = Distance(trip[p], trip[i]) +
+							 (p + 1 < n ? Distance(trip[j], trip[p + 1]) - Distance(trip[p], trip[p + 1]) : 0);
+				if (bridged + added < removed) {
+					scratch.segment.assign(trip.begin() + i, trip.begin() + j + 1);
+					trip.erase(trip.begin() + i, trip.begin() + j + 1);
+					int at = p < i ? p + 1 : p + 1 - length;
+					trip.insert(trip.begin() + at, scratch.segment.begin(), scratch.segment.end());
+					changed = true;
+					break;
+				}
+			}
+		}
+	}
+	return changed;
+}
@@ -0,0 +1,139 @@
+#ifndef TRIPPLANNER_H
+#define TRIPPLANNER_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <QElapsedTimer>
+#include "distancematrix.h"
+
+/*!
+ * @class TripPlanner
+ * @brief Orders the stops of a trip that starts at a fixed team and ends at
+ * whichever stop makes the trip shortest. Small trips are solved exactly
+ * with Held-Karp; larger ones start from the nearest neighbour order and are
+ * improved with 2-opt and Or-opt moves until no move helps or the time
+ * budget runs out. All distances come from the cached DistanceMatrix.
+ *
+ * Held-Karp layers and local search restarts are spread over a WorkerPool.
+ * Progress is reported on the calling thread, which may cancel the run;
+ * a cancelled run returns the best trip found so far
+ */
+class TripPlanner {
+public:
+	/// largest number of stops (excluding the start) solved exactly
+	static const int EXACT_LIMIT = 18;
+
+	/*!
+	 * @brief called on the calling thread while a plan runs
+	 * @param percent; 0 to 100
+	 * @return false to cancel the plan
+	 */
+	using Progress = std::function<bool(int percent)>;
+
+	/*!
+	 * @brief Constructor
+	 * @param matrix; distance matrix to plan with
+	 * @param threads; worker threads, <= 0 for one per core
+	 */
+	explicit TripPlanner(std::shared_ptr<const DistanceMatrix> matrix, int threads = 0);
+
+	/*!
+	 * @brief shortest order, exact when stops.size() <= EXACT_LIMIT
+	 * @param start; vertex the trip starts from
+	 * @param stops; vertices to visit, start excluded
+	 * @param budgetMs; time limit for local search in milliseconds
+	 * @param progress; progress callback, may be empty
+	 * @return start followed by the stops in visiting order
+	 */
+	std::vector<int> Optimize(int start, const std::vector<int> &stops,
+							  int budgetMs = 200, const Progress &progress = {});
+
+	/*!
+	 * @brief nearest neighbour order (same rule as MainWindow::RecursiveAlgo)
+	 * @param start; vertex the trip starts from
+	 * @param stops; vertices to visit, start excluded
+	 * @return start followed by the stops in visiting order
+	 */
+	std::vector<int> Greedy(int start, const std::vector<int> &stops) const;
+
+	/*!
+	 * @brief exact shortest order by Held-Karp dynamic programming,
+	 * O(n^2 2^n) time and O(n 2^n) memory. Each layer of subsets of the same
+	 * size is split between the threads, and partial trips already longer
+	 * than the local search result are dropped
+	 * @param start; vertex the trip starts from
+	 * @param stops; vertices to visit, start excluded, at most EXACT_LIMIT
+	 * @param progress; progress callback, may be empty
+	 * @return start followed by the stops in visiting order
+	 */
+	std::vector<int> HeldKarp(int start, const std::vector<int> &stops,
+							  const Progress &progress = {});
+
+	/*!
+	 * @brief improves a trip with 2-opt and Or-opt moves; the first stop
+	 * stays fixed
+	 * @param trip; vertices in visiting order
+	 * @param budgetMs; time limit in milliseconds, <= 0 for no limit
+	 * @return improved trip, never longer than the input
+	 */
+	std::vector<int> LocalSearch(std::vector<int> trip, int budgetMs) const;
+
+	/*!
+	 * @brief iterated local search: every thread repeatedly kicks the best
+	 * trip found so far with a random double bridge move and runs
+	 * LocalSearch on it, sharing improvements with the other threads
+	 * @param trip; vertices in visiting order
+	 * @param budgetMs; time limit in milliseconds
+	 * @param progress; progress callback, may be empty
+	 * @return best trip found, never longer than the input
+	 */
+	std::vector<int> Restarts(std::vector<int> trip, int budgetMs,
+							  const Progress &progress = {});
+
+	/*!
+	 * @brief total distance of a trip
+	 * @param trip; vertices in visiting order
+	 * @return distance
+	 */
+	long Length(const std::vector<int> &trip) const;
+
+	/*!
+	 * @brief stops the running plan and any later one; safe to call from
+	 * any thread
+	 */
+	void Cancel() { cancelled = true; }
+
+	/*!
+	 * @brief whether the planner was cancelled
+	 * @return bool
+	 */
+	bool Cancelled() const { return cancelled; }
+
+private:
+	/// per thread buffers reused by every local search pass
+	struct Scratch {
+		std::vector<long> forward;	/// prefix cost walking the trip forwards
+		std::vector<long> backward;	/// prefix cost walking the trip backwards
+		std::vector<int> segment;	/// segment being moved by Or-opt
+	};
+
+	// local search until no move helps, the budget runs out or cancelled
+	void Descend(std::vector<int> &trip, Scratch &scratch,
+				 const QElapsedTimer &timer, int budgetMs) const;
+
+	// one pass of improving 2-opt moves, true if the trip changed
+	bool TwoOpt(std::vector<int> &trip, Scratch &scratch) const;
+
+	// one pass of improving segment moves, true if the trip changed
+	bool OrOpt(std::vector<int> &trip, Scratch &scratch) const;
+
+	int Distance(int from, int to) const { return matrix->Distance(from, to); }
+
+	std::shared_ptr<const DistanceMatrix> matrix;
+	int threads;	/// worker threads per plan
+	std::atomic<bool> cancelled{false};
+};
+
+#endif // TRIPPLANNER_H
@@ -0,0 +1,64 @@
+#include "workerpool.h"
+#include <algorithm>
+#include <chrono>
+
+WorkerPool::WorkerPool(int size)
+{
+	for (int i = 0; i < std::max(1, size); i++)
+		threads.emplace_back(&WorkerPool::Work, this, i);
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (auto &thread : threads)
+		thread.join();
+}
+
+int WorkerPool::DefaultSize()
+{
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void WorkerPool::Run(const std::function<void(int)> &task, const std::function<void()> &poll)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	job = &task;
+	running = threads.size();
+	generation++;
+	wake.notify_all();
+
+	while (!finished.wait_for(lock, std::chrono::milliseconds(20), [this] { return running == 0; })) {
+		if (poll) {
+			lock.unlock();
+			poll();
+			lock.lock();
+		}
+	}
+	job = nullptr;
+}
+
+void WorkerPool::Work(int thread)
+{
+	unsigned seen = 0;
+	std::unique_lock<std::mutex> lock(mutex);
+
+	for (;;) {
+		wake.wait(lock, [&] { return stopping || generation != seen; });
+		if (stopping)
+			return;
+		seen = generation;
+
+		const std::function<void(int)> *task = job;
+		lock.unlock();
+		(*task)(thread);
+		lock.lock();
+
+		if (--running == 0)
+			finished.notify_all();
+	}
+}
@@ -0,0 +1,65 @@
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*!
+ * @class WorkerPool
+ * @brief Fixed set of threads that run the same job together. The calling
+ * thread does not take part; it waits for the job and polls in between so
+ * it can report progress or ask the job to stop
+ */
+class WorkerPool {
+public:
+	/*!
+	 * @brief Starts the threads
+	 * @param size; number of threads, at least one is started
+	 */
+	explicit WorkerPool(int size);
+
+	/*!
+	 * @brief Stops and joins the threads
+	 */
+	~WorkerPool();
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	/*!
+	 * @brief number of threads
+	 * @return int
+	 */
+	int Size() const { return threads.size(); }
+
+	/*!
+	 * @brief runs job(thread index) on every thread and waits for all of them
+	 * @param job; work to run, must return on its own
+	 * @param poll; called on the calling thread every few milliseconds while
+	 * the job runs, may be empty
+	 */
+	void Run(const std::function<void(int)> &job, const std::function<void()> &poll = {});
+
+	/*!
+	 * @brief threads to use when the caller has no preference
+	 * @return hardware concurrency, at least 1
+	 */
+	static int DefaultSize();
+
+private:
+	void Work(int thread);	// thread main loop
+
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable wake;	/// signals a new job or shutdown
+	std::condition_variable finished;	/// signals a thread finished the job
+	const std::function<void(int)> *job = nullptr;	/// job being run
+	unsigned generation = 0;	/// incremented for every job
+	int running = 0;	/// threads still running the job
+	bool stopping = false;
+};
+
+#endif // WORKERPOOL_H